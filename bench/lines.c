@@ -0,0 +1,268 @@
+/**
+ * -------------------------------------------------------------------------------------+
+ * @desc        SSD1306 Benchmark - line rasterizer
+ * -------------------------------------------------------------------------------------+
+ *              Copyright (C) 2020 Marian Hrinko.
+ *              Written by Marian Hrinko (mato.hrinko@gmail.com)
+ *
+ * @author      Marian Hrinko
+ * @date        17.10.2026
+ * @file        lines.c
+ * @version     1.0.0
+ * @tested      Linux
+ *
+ * @depend      ssd1306.h, emulator.h
+ * -------------------------------------------------------------------------------------+
+ * @descr       SSD1306_DrawLine (page-byte spans) against previous rasterizer -
+ *              Bresenham drawing pixel by pixel by SSD1306_DrawPixel. Random lines
+ *              have to give same cache and dirty ranges on 64 and 32 row version,
+ *              then both are timed on oscilloscope trace, steep and shallow lines.
+ * -------------------------------------------------------------------------------------+
+ * @usage       make -C bench lines && bench/lines [random lines]
+ */
+
+// @includes
+#include "ssd1306.h"
+#include "emulator.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+// @const repetitions of timed scenes
+#define LINES_RUNS                100000
+
+/**
+ * @desc    Time of monotonic clock
+ *
+ * @param   void
+ *
+ * @return  double [us]
+ */
+static double Lines_Now (void)
+{
+  struct timespec time;
+
+  clock_gettime (CLOCK_MONOTONIC, &time);
+  return time.tv_sec * 1e6 + time.tv_nsec / 1e3;
+}
+
+/**
+ * @desc    Previous rasterizer - Bresenham, every point drawn by SSD1306_DrawPixel
+ *
+ * @param   SSD1306_Display *
+ * @param   int16_t x start
+ * @param   int16_t x end
+ * @param   int16_t y start
+ * @param   int16_t y end
+ *
+ * @return  void
+ */
+static void Lines_Pixels (SSD1306_Display *lcd, int16_t x1, int16_t x2, int16_t y1, int16_t y2)
+{
+  // determinant
+  int16_t D;
+  // deltas
+  int16_t delta_x = x2 - x1, delta_y = y2 - y1;
+  // steps
+  int16_t trace_x = 1, trace_y = 1;
+
+  // horizontal and vertical lines drawn by spans
+  if (y1 == y2) {
+    SSD1306_DrawHLine (lcd, x1 < x2 ? x1 : x2, y1, (x1 < x2 ? x2 - x1 : x1 - x2) + 1);
+    return;
+  }
+  if (x1 == x2) {
+    SSD1306_DrawVLine (lcd, x1, y1 < y2 ? y1 : y2, (y1 < y2 ? y2 - y1 : y1 - y2) + 1);
+    return;
+  }
+  // directions
+  if (delta_x < 0) {
+    delta_x = -delta_x;
+    trace_x = -1;
+  }
+  if (delta_y < 0) {
+    delta_y = -delta_y;
+    trace_y = -1;
+  }
+
+  // m < 1
+  if (delta_y < delta_x) {
+    D = (delta_y << 1) - delta_x;
+    SSD1306_DrawPixel (lcd, x1, y1);
+    while (x1 != x2) {
+      x1 += trace_x;
+      if (D >= 0) {
+        y1 += trace_y;
+        D -= 2 * delta_x;
+      }
+      D += 2 * delta_y;
+      SSD1306_DrawPixel (lcd, x1, y1);
+    }
+  // m >= 1
+  } else {
+    D = delta_y - (delta_x << 1);
+    SSD1306_DrawPixel (lcd, x1, y1);
+    while (y1 != y2) {
+      y1 += trace_y;
+      if (D <= 0) {
+        x1 += trace_x;
+        D += 2 * delta_y;
+      }
+      D -= 2 * delta_x;
+      SSD1306_DrawPixel (lcd, x1, y1);
+    }
+  }
+}
+
+/**
+ * @desc    Empty cache, clean dirty ranges
+ *
+ * @param   SSD1306_Display *
+ *
+ * @return  void
+ */
+static void Lines_Reset (SSD1306_Display *lcd)
+{
+  SSD1306_ClearCache (lcd->cacheMemLcd);
+  SSD1306_MarkScreen (lcd, 0);
+}
+
+/**
+ * @desc    Random lines drawn by both rasterizers
+ *
+ * @param   uint8_t height 64 / 32
+ * @param   long number of lines
+ *
+ * @return  long lines with different pixels or dirty ranges
+ */
+static long Lines_Compare (uint8_t height, long count)
+{
+  static SSD1306_Emulator emulator[2];
+  static SSD1306_Display lcd[2];
+  int16_t x1, x2, y1, y2;
+  long mismatches = 0;
+  long i;
+
+  SSD1306_Init (&lcd[0], EMU_Setup (&emulator[0], 0), SSD1306_ADDR, height);
+  SSD1306_Init (&lcd[1], EMU_Setup (&emulator[1], 0), SSD1306_ADDR, height);
+
+  srand (1);
+  for (i = 0; i < count; i++) {
+    x1 = rand () % RAM_X_END;
+    x2 = rand () % RAM_X_END;
+    y1 = rand () % height;
+    y2 = rand () % height;
+    Lines_Reset (&lcd[0]);
+    Lines_Reset (&lcd[1]);
+    Lines_Pixels (&lcd[0], x1, x2, y1, y2);
+    SSD1306_DrawLine (&lcd[1], x1, x2, y1, y2);
+    // pixels and dirty ranges
+    if (memcmp (lcd[0].cacheMemLcd, lcd[1].cacheMemLcd, CACHE_SIZE_MEM) ||
+        memcmp (lcd[0].dirtyStart, lcd[1].dirtyStart, RAM_Y_END) ||
+        memcmp (lcd[0].dirtyEnd, lcd[1].dirtyEnd, RAM_Y_END)) {
+      mismatches++;
+    }
+  }
+
+  // lines with difference
+  return mismatches;
+}
+
+/**
+ * @desc    Time of scene drawn by rasterizer
+ *
+ * @param   SSD1306_Display *
+ * @param   void (*) (SSD1306_Display *, int16_t, int16_t, int16_t, int16_t) rasterizer
+ * @param   uint8_t scene 0 trace, 1 steep lines, 2 shallow lines
+ * @param   const uint8_t * rows of trace
+ *
+ * @return  double [us] per scene
+ */
+static double Lines_Time (SSD1306_Display *lcd, void (*line) (SSD1306_Display *, int16_t, int16_t, int16_t, int16_t), uint8_t scene, const uint8_t *rows)
+{
+  int16_t height = lcd->pages << 3;
+  double start = Lines_Now ();
+  long n;
+  int16_t i;
+
+  for (n = 0; n < LINES_RUNS; n++) {
+    switch (scene) {
+      // oscilloscope trace of 127 segments
+      case 0:
+        for (i = 0; i < END_COLUMN_ADDR; i++) {
+          line (lcd, i, i + 1, rows[(i + n) & 0x7F], rows[(i + n + 1) & 0x7F]);
+        }
+        break;
+      // 16 steep lines over whole height
+      case 1:
+        for (i = 0; i < 16; i++) {
+          line (lcd, i * 8, i * 8 + 5, 0, height - 1);
+        }
+        break;
+      // 8 shallow lines over whole width
+      default:
+        for (i = 0; i < 8; i++) {
+          line (lcd, 0, END_COLUMN_ADDR, i * 4, height - 1 - i * 4);
+        }
+        break;
+    }
+  }
+
+  // per scene
+  return (Lines_Now () - start) / LINES_RUNS;
+}
+
+/**
+ * @desc    New rasterizer in signature of previous one
+ *
+ * @param   SSD1306_Display *
+ * @param   int16_t x start
+ * @param   int16_t x end
+ * @param   int16_t y start
+ * @param   int16_t y end
+ *
+ * @return  void
+ */
+static void Lines_Spans (SSD1306_Display *lcd, int16_t x1, int16_t x2, int16_t y1, int16_t y2)
+{
+  SSD1306_DrawLine (lcd, x1, x2, y1, y2);
+}
+
+/**
+ * @desc    Main function
+ *
+ * @param   int argc
+ * @param   char ** argv - [number of random lines, 200000]
+ *
+ * @return  int 0 if both rasterizers draw same pixels
+ */
+int main (int argc, char **argv)
+{
+  static const char *scenes[] = { "127-segment trace", "16 steep lines", "8 shallow lines" };
+  static SSD1306_Emulator emulator;
+  static SSD1306_Display lcd;
+  long count = argc > 1 ? atol (argv[1]) : 200000;
+  long mismatches64, mismatches32;
+  uint8_t rows[RAM_X_END];
+  double before, after;
+  uint8_t scene, i;
+
+  // same pixels and dirty ranges
+  mismatches64 = Lines_Compare (64, count);
+  mismatches32 = Lines_Compare (32, count);
+  printf ("%ld random lines: mismatches 64 rows %ld, 32 rows %ld\n", count, mismatches64, mismatches32);
+
+  // timing on 64 row version
+  SSD1306_Init (&lcd, EMU_Setup (&emulator, 0), SSD1306_ADDR, 64);
+  for (i = 0; i < RAM_X_END; i++) {
+    rows[i] = rand () % 64;
+  }
+  for (scene = 0; scene < 3; scene++) {
+    before = Lines_Time (&lcd, Lines_Pixels, scene, rows);
+    after = Lines_Time (&lcd, Lines_Spans, scene, rows);
+    printf ("%-18s DrawPixel %6.2f us  spans %6.2f us  %4.1fx\n", scenes[scene], before, after, before / after);
+  }
+
+  // status
+  return (mismatches64 || mismatches32) ? 1 : 0;
+}
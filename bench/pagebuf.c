@@ -0,0 +1,179 @@
+/**
+ * -------------------------------------------------------------------------------------+
+ * @desc        SSD1306 Benchmark - page-buffer mode
+ * -------------------------------------------------------------------------------------+
+ *              Copyright (C) 2020 Marian Hrinko.
+ *              Written by Marian Hrinko (mato.hrinko@gmail.com)
+ *
+ * @author      Marian Hrinko
+ * @date        17.10.2026
+ * @file        pagebuf.c
+ * @version     1.0.0
+ * @tested      Linux
+ *
+ * @depend      ssd1306.h, emulator.h
+ * -------------------------------------------------------------------------------------+
+ * @descr       Same scenes drawn and updated on 64 row version, built once as full
+ *              buffer and once with SSD1306_PAGE_BUFFER (pagebuf-full, pagebuf-page).
+ *              Prints size of display, time of drawing and update, bytes,
+ *              transactions and transport calls per frame - dashboard (text, bar,
+ *              graph, icon), clock (large digits) and full screen switched on and off.
+ * -------------------------------------------------------------------------------------+
+ * @usage       make -C bench pagebuf-page && bench/pagebuf-page [frames]
+ */
+
+// @includes
+#include "ssd1306.h"
+#include "emulator.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+// @const size of icon
+#define PAGEBUF_ICON              16
+
+// @var emulated display
+static SSD1306_Emulator emulator;
+static SSD1306_Display lcd;
+// @var icon of dashboard
+static uint8_t icon[SSD1306_BITMAP_SIZE (PAGEBUF_ICON, PAGEBUF_ICON)];
+static const SSD1306_Bitmap bitmap = { PAGEBUF_ICON, PAGEBUF_ICON, icon };
+
+/**
+ * @desc    Time of monotonic clock
+ *
+ * @param   void
+ *
+ * @return  double [ns]
+ */
+static double Pagebuf_Now (void)
+{
+  struct timespec time;
+
+  clock_gettime (CLOCK_MONOTONIC, &time);
+  return time.tv_sec * 1e9 + time.tv_nsec;
+}
+
+/**
+ * @desc    Dashboard - two values, progress bar, graph of 12 lines and icon
+ *
+ * @param   long frame
+ *
+ * @return  void
+ */
+static void Pagebuf_Dashboard (long frame)
+{
+  char text[16];
+  int16_t i;
+
+  SSD1306_ClearScreen (&lcd);
+  SSD1306_SetDrawMode (&lcd, SSD1306_MODE_SET);
+  sprintf (text, "CPU %3ld%%", frame % 100);
+  SSD1306_DrawText (&lcd, 0, 0, &SSD1306_FONT_8X8, 1, text);
+  sprintf (text, "MEM %3ld%%", (frame * 7) % 100);
+  SSD1306_DrawText (&lcd, 0, 10, &SSD1306_FONT_8X8, 1, text);
+  SSD1306_DrawRect (&lcd, 0, 22, 128, 8);
+  SSD1306_FillRect (&lcd, 2, 24, (frame % 124) + 1, 4);
+  for (i = 0; i < 12; i++) {
+    SSD1306_DrawLine (&lcd, i * 10, i * 10 + 10, 63 - ((frame + i * 5) % 24), 63 - ((frame + i * 5 + 5) % 24));
+  }
+  SSD1306_DrawBitmap (&lcd, 110, 0, &bitmap);
+}
+
+/**
+ * @desc    Clock - digits of double size and label
+ *
+ * @param   long frame - seconds
+ *
+ * @return  void
+ */
+static void Pagebuf_Clock (long frame)
+{
+  char text[8];
+
+  SSD1306_ClearScreen (&lcd);
+  sprintf (text, "%02ld:%02ld", (frame / 60) % 60, frame % 60);
+  SSD1306_DrawText (&lcd, 4, 16, &SSD1306_FONT_8X8, 2, text);
+  SSD1306_DrawText (&lcd, 4, 48, &SSD1306_FONT_8X8, 1, "uptime");
+}
+
+/**
+ * @desc    Full screen - every other frame filled
+ *
+ * @param   long frame
+ *
+ * @return  void
+ */
+static void Pagebuf_Full (long frame)
+{
+  SSD1306_ClearScreen (&lcd);
+  SSD1306_SetDrawMode (&lcd, SSD1306_MODE_SET);
+  if (frame & 1) {
+    SSD1306_FillRect (&lcd, 0, 0, RAM_X_END, 64);
+  }
+}
+
+/**
+ * @desc    Scene drawn and updated frame by frame
+ *
+ * @param   const char * name
+ * @param   void (*) (long) scene
+ * @param   long frames
+ *
+ * @return  void
+ */
+static void Pagebuf_Run (const char *name, void (*scene) (long), long frames)
+{
+  double draw = 0, update = 0, start;
+  long frame;
+
+  // empty display, statistics of scene only
+  SSD1306_ClearScreen (&lcd);
+  SSD1306_UpdateScreen (&lcd);
+  EMU_ResetStats (&emulator);
+
+  for (frame = 0; frame < frames; frame++) {
+    start = Pagebuf_Now ();
+    scene (frame);
+    draw += Pagebuf_Now () - start;
+    start = Pagebuf_Now ();
+    SSD1306_UpdateScreen (&lcd);
+    update += Pagebuf_Now () - start;
+  }
+
+  // per frame
+  printf ("%-10s draw %7.0f ns  update %7.0f ns  %7.1f B %5.2f tr %5.2f calls\n", name, draw / frames, update / frames,
+          (double) emulator.stats.bytes / frames, (double) emulator.stats.transactions / frames,
+          (double) emulator.stats.round_trips / frames);
+}
+
+/**
+ * @desc    Main function
+ *
+ * @param   int argc
+ * @param   char ** argv - [frames of scene, 20000]
+ *
+ * @return  int
+ */
+int main (int argc, char **argv)
+{
+  long frames = argc > 1 ? atol (argv[1]) : 20000;
+  size_t i;
+
+  for (i = 0; i < sizeof (icon); i++) {
+    icon[i] = i * 37;
+  }
+  SSD1306_Init (&lcd, EMU_Setup (&emulator, 0), SSD1306_ADDR, 64);
+
+#ifdef SSD1306_PAGE_BUFFER
+  printf ("page buffer: sizeof(SSD1306_Display) %zu B, per frame\n", sizeof (SSD1306_Display));
+#else
+  printf ("full buffer: sizeof(SSD1306_Display) %zu B, per frame\n", sizeof (SSD1306_Display));
+#endif
+  Pagebuf_Run ("dashboard", Pagebuf_Dashboard, frames);
+  Pagebuf_Run ("clock", Pagebuf_Clock, frames);
+  Pagebuf_Run ("full", Pagebuf_Full, frames / 4);
+
+  // success
+  return 0;
+}
@@ -0,0 +1,249 @@
+/**
+ * -------------------------------------------------------------------------------------+
+ * @desc        SSD1306 Asynchronous update
+ * -------------------------------------------------------------------------------------+
+ *              Copyright (C) 2020 Marian Hrinko.
+ *              Written by Marian Hrinko (mato.hrinko@gmail.com)
+ *
+ * @author      Marian Hrinko
+ * @date        17.10.2026
+ * @file        async.c
+ * @version     1.0.0
+ * @tested      Linux
+ *
+ * @depend      async.h
+ * -------------------------------------------------------------------------------------+
+ * @usage       Overlap of drawing and transfer
+ */
+
+// @includes
+#include "async.h"
+
+#include <time.h>
+
+// frames are copies of whole cache, not built in page-buffer mode
+#ifndef SSD1306_PAGE_BUFFER
+
+/**
+ * @desc    Merge dirty ranges
+ *
+ * @param   uint8_t * first columns of pages, merged
+ * @param   uint8_t * last columns of pages, merged
+ * @param   const uint8_t * first columns of pages
+ * @param   const uint8_t * last columns of pages
+ *
+ * @return  void
+ */
+static void SSD1306_Async_Merge (uint8_t *starts, uint8_t *ends, const uint8_t *first, const uint8_t *last)
+{
+  uint8_t page;
+
+  // union of ranges
+  for (page = START_PAGE_ADDR; page < RAM_Y_END; page++) {
+    if (first[page] < starts[page]) {
+      starts[page] = first[page];
+    }
+    if (last[page] > ends[page]) {
+      ends[page] = last[page];
+    }
+  }
+}
+
+/**
+ * @desc    Flush thread - sends latest presented frame
+ *
+ * @param   void * SSD1306_Async *
+ *
+ * @return  void *
+ */
+static void * SSD1306_Async_Thread (void *arg)
+{
+  SSD1306_Async *async = arg;
+  // swapped buffer
+  uint8_t *buffer;
+  // duration of flush
+  struct timespec t0, t1;
+  // status
+  uint8_t status;
+
+  pthread_mutex_lock (&async->lock);
+  while (1) {
+    // wait for frame
+    while (!async->waiting && async->running) {
+      pthread_cond_wait (&async->ready, &async->lock);
+    }
+    // stopped, all frames sent
+    if (!async->waiting) {
+      break;
+    }
+
+    // take latest frame at frame boundary
+    buffer = async->front;
+    async->front = async->pending;
+    async->pending = buffer;
+    memcpy (async->frontStart, async->pendingStart, RAM_Y_END);
+    memcpy (async->frontEnd, async->pendingEnd, RAM_Y_END);
+    memset (async->pendingStart, 0xFF, RAM_Y_END);
+    memset (async->pendingEnd, 0x00, RAM_Y_END);
+    async->waiting = 0;
+    async->busy = 1;
+    pthread_mutex_unlock (&async->lock);
+
+    // send frame, next one is drawn meanwhile
+    clock_gettime (CLOCK_MONOTONIC, &t0);
+    status = SSD1306_UpdateFrame (async->lcd, async->front, async->frontStart, async->frontEnd);
+    clock_gettime (CLOCK_MONOTONIC, &t1);
+
+    pthread_mutex_lock (&async->lock);
+    // request succesfull
+    if (SSD1306_SUCCESS != status) {
+      // ranges sent again with next frame
+      SSD1306_Async_Merge (async->pendingStart, async->pendingEnd, async->frontStart, async->frontEnd);
+    }
+    async->status = status;
+    async->busy = 0;
+    async->flushed++;
+    async->flush_us = (t1.tv_sec - t0.tv_sec) * 1e6 + (t1.tv_nsec - t0.tv_nsec) / 1e3;
+    pthread_cond_broadcast (&async->idle);
+  }
+  pthread_mutex_unlock (&async->lock);
+
+  return NULL;
+}
+
+/**
+ * @desc    Start flush thread, display has to be initialized
+ *
+ * @param   SSD1306_Async *
+ * @param   SSD1306_Display *
+ *
+ * @return  uint8_t
+ */
+uint8_t SSD1306_Async_Start (SSD1306_Async *async, SSD1306_Display *lcd)
+{
+  // display owned by other flush thread or transaction open
+  if (lcd->owned || lcd->batchDepth) {
+    // error
+    return SSD1306_ERROR;
+  }
+
+  async->lcd = lcd;
+  async->pending = async->buffers[0];
+  async->front = async->buffers[1];
+  memset (async->pendingStart, 0xFF, RAM_Y_END);
+  memset (async->pendingEnd, 0x00, RAM_Y_END);
+  async->waiting = 0;
+  async->busy = 0;
+  async->running = 1;
+  async->status = SSD1306_SUCCESS;
+  async->presented = 0;
+  async->flushed = 0;
+  async->dropped = 0;
+  async->flush_us = 0;
+
+  pthread_mutex_init (&async->lock, NULL);
+  pthread_cond_init (&async->ready, NULL);
+  pthread_cond_init (&async->idle, NULL);
+
+  // flush thread
+  if (pthread_create (&async->thread, NULL, SSD1306_Async_Thread, async)) {
+    pthread_cond_destroy (&async->idle);
+    pthread_cond_destroy (&async->ready);
+    pthread_mutex_destroy (&async->lock);
+    // error
+    return SSD1306_ERROR;
+  }
+  // display sent to by flush thread only, first frame is taken under lock
+  lcd->owner = async->thread;
+  lcd->owned = 1;
+
+  // success
+  return SSD1306_SUCCESS;
+}
+
+/**
+ * @desc    Present frame drawn into cache of display, does not wait for transfer
+ *
+ * @param   SSD1306_Async *
+ *
+ * @return  uint8_t status of last finished flush
+ */
+uint8_t SSD1306_Async_Present (SSD1306_Async *async)
+{
+  SSD1306_Display *lcd = async->lcd;
+  // status
+  uint8_t status;
+
+  pthread_mutex_lock (&async->lock);
+  // previous frame not taken, latest frame wins
+  if (async->waiting) {
+    async->dropped++;
+  }
+  // copy of back buffer, drawing continues on it
+  memcpy (async->pending, lcd->cacheMemLcd, CACHE_SIZE_MEM);
+  SSD1306_Async_Merge (async->pendingStart, async->pendingEnd, lcd->dirtyStart, lcd->dirtyEnd);
+  async->waiting = 1;
+  async->presented++;
+  status = async->status;
+  pthread_cond_signal (&async->ready);
+  pthread_mutex_unlock (&async->lock);
+
+  // changes handed over to flush thread
+  SSD1306_MarkScreen (lcd, 0);
+
+  // status
+  return status;
+}
+
+/**
+ * @desc    Wait until presented frames are sent
+ *
+ * @param   SSD1306_Async *
+ *
+ * @return  uint8_t status of last finished flush
+ */
+uint8_t SSD1306_Async_Wait (SSD1306_Async *async)
+{
+  // status
+  uint8_t status;
+
+  pthread_mutex_lock (&async->lock);
+  // frame waiting or being sent
+  while (async->waiting || async->busy) {
+    pthread_cond_wait (&async->idle, &async->lock);
+  }
+  status = async->status;
+  pthread_mutex_unlock (&async->lock);
+
+  // status
+  return status;
+}
+
+/**
+ * @desc    Send presented frames and stop flush thread
+ *
+ * @param   SSD1306_Async *
+ *
+ * @return  uint8_t status of last finished flush
+ */
+uint8_t SSD1306_Async_Stop (SSD1306_Async *async)
+{
+  pthread_mutex_lock (&async->lock);
+  async->running = 0;
+  pthread_cond_signal (&async->ready);
+  pthread_mutex_unlock (&async->lock);
+
+  // waiting frame is sent before thread ends
+  pthread_join (async->thread, NULL);
+  // display back to application
+  async->lcd->owned = 0;
+
+  pthread_cond_destroy (&async->idle);
+  pthread_cond_destroy (&async->ready);
+  pthread_mutex_destroy (&async->lock);
+
+  // status
+  return async->status;
+}
+
+#endif
@@ -0,0 +1,101 @@
+/**
+ * -------------------------------------------------------------------------------------+
+ * @desc        SSD1306 Asynchronous update
+ * -------------------------------------------------------------------------------------+
+ *              Copyright (C) 2020 Marian Hrinko.
+ *              Written by Marian Hrinko (mato.hrinko@gmail.com)
+ *
+ * @author      Marian Hrinko
+ * @date        17.10.2026
+ * @file        async.h
+ * @version     1.0.0
+ * @tested      Linux
+ *
+ * @depend      ssd1306.h, pthread.h
+ * -------------------------------------------------------------------------------------+
+ * @descr       Application draws into 'cacheMemLcd' of display (back buffer) and
+ *              presents finished frame. Flush thread sends frames to display while
+ *              next frame is drawn. One frame waits at most - latest frame wins,
+ *              frame presented before previous one was taken is dropped and its
+ *              dirty ranges are merged into the latest one.
+ *              While flush thread runs it owns the display - commands, scroll,
+ *              start line, Begin / End and updates of other threads fail
+ *              (SSD1306_SetStartLine and SSD1306_Begin are ignored), they are set
+ *              before SSD1306_Async_Start or after SSD1306_Async_Stop.
+ *              Not available in page-buffer mode (SSD1306_PAGE_BUFFER).
+ * -------------------------------------------------------------------------------------+
+ * @usage       Overlap of drawing and transfer
+ */
+
+#ifndef __ASYNC_H__
+#define __ASYNC_H__
+
+  // @includes
+  #include <pthread.h>
+  #include "ssd1306.h"
+
+  // @struct Asynchronous update
+  typedef struct {
+    SSD1306_Display *lcd;
+    pthread_t thread;                     // flush thread
+    pthread_mutex_t lock;
+    pthread_cond_t ready;                 // frame presented / stop requested
+    pthread_cond_t idle;                  // frame sent
+    // frames
+    uint8_t buffers[2][CACHE_SIZE_MEM];
+    uint8_t *pending;                     // presented frame waiting for flush thread
+    uint8_t *front;                       // frame sent by flush thread
+    uint8_t pendingStart[RAM_Y_END];      // dirty ranges accumulated since frame taken
+    uint8_t pendingEnd[RAM_Y_END];
+    uint8_t frontStart[RAM_Y_END];        // dirty ranges of frame being sent
+    uint8_t frontEnd[RAM_Y_END];
+    // state
+    uint8_t waiting;                      // pending frame not taken yet
+    uint8_t busy;                         // front frame being sent
+    uint8_t running;
+    uint8_t status;                       // status of last flush
+    // statistics
+    unsigned long presented;
+    unsigned long flushed;
+    unsigned long dropped;
+    double flush_us;                      // duration of last flush
+  } SSD1306_Async;
+
+  /**
+   * @desc    Start flush thread, display has to be initialized
+   *
+   * @param   SSD1306_Async *
+   * @param   SSD1306_Display *
+   *
+   * @return  uint8_t
+   */
+  uint8_t SSD1306_Async_Start (SSD1306_Async *, SSD1306_Display *);
+
+  /**
+   * @desc    Present frame drawn into cache of display, does not wait for transfer
+   *
+   * @param   SSD1306_Async *
+   *
+   * @return  uint8_t status of last finished flush
+   */
+  uint8_t SSD1306_Async_Present (SSD1306_Async *);
+
+  /**
+   * @desc    Wait until presented frames are sent
+   *
+   * @param   SSD1306_Async *
+   *
+   * @return  uint8_t status of last finished flush
+   */
+  uint8_t SSD1306_Async_Wait (SSD1306_Async *);
+
+  /**
+   * @desc    Send presented frames and stop flush thread
+   *
+   * @param   SSD1306_Async *
+   *
+   * @return  uint8_t status of last finished flush
+   */
+  uint8_t SSD1306_Async_Stop (SSD1306_Async *);
+
+#endif
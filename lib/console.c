@@ -0,0 +1,189 @@
+/**
+ * -------------------------------------------------------------------------------------+
+ * @desc        SSD1306 Text console
+ * -------------------------------------------------------------------------------------+
+ *              Copyright (C) 2020 Marian Hrinko.
+ *              Written by Marian Hrinko (mato.hrinko@gmail.com)
+ *
+ * @author      Marian Hrinko
+ * @date        17.10.2026
+ * @file        console.c
+ * @version     1.0.0
+ * @tested      Linux
+ *
+ * @depend      console.h
+ * -------------------------------------------------------------------------------------+
+ * @usage       Scrolling text log
+ */
+
+// @includes
+#include "console.h"
+
+// console writes RAM pages into cache, not built in page-buffer mode
+#ifndef SSD1306_PAGE_BUFFER
+
+/**
+ * @desc    RAM page of line on screen
+ *
+ * @param   SSD1306_Console *
+ * @param   uint8_t line on screen
+ *
+ * @return  uint8_t
+ */
+static inline uint8_t SSD1306_Console_Page (SSD1306_Console *console, uint8_t row)
+{
+  // ring of RAM pages
+  return (console->top + row * console->height) % RAM_Y_END;
+}
+
+/**
+ * @desc    Clear line on screen
+ *
+ * @param   SSD1306_Console *
+ * @param   uint8_t line on screen
+ *
+ * @return  void
+ */
+static void SSD1306_Console_ClearLine (SSD1306_Console *console, uint8_t row)
+{
+  uint8_t page = SSD1306_Console_Page (console, row);
+  uint8_t p;
+
+  // whole pages of line
+  for (p = page; p < page + console->height; p++) {
+    memset (console->lcd->cacheMemLcd + CACHE_INDEX (0, p), 0x00, RAM_X_END);
+    SSD1306_MarkRange (console->lcd, p, START_COLUMN_ADDR, END_COLUMN_ADDR);
+  }
+}
+
+/**
+ * @desc    Move cursor to new line, top line leaves screen on last line
+ *
+ * @param   SSD1306_Console *
+ *
+ * @return  void
+ */
+static void SSD1306_Console_NewLine (SSD1306_Console *console)
+{
+  console->column = 0;
+  // free line on screen
+  if (console->row + 1 < console->rows) {
+    console->row++;
+    return;
+  }
+  // next page of ring on top, start line follows
+  console->top = (console->top + console->height) % RAM_Y_END;
+  SSD1306_SetStartLine (console->lcd, console->top << 3);
+  // new last line
+  SSD1306_Console_ClearLine (console, console->row);
+}
+
+/**
+ * @desc    Init console, screen cleared
+ *
+ * @param   SSD1306_Console *
+ * @param   SSD1306_Display *
+ * @param   const SSD1306_Font *
+ * @param   uint8_t scale 1, 2, 4 (line of whole pages dividing RAM)
+ *
+ * @return  uint8_t
+ */
+uint8_t SSD1306_Console_Init (SSD1306_Console *console, SSD1306_Display *lcd, const SSD1306_Font *font, uint8_t scale)
+{
+  // glyphs of font / scale pair
+  const SSD1306_Glyphs *glyphs = SSD1306_GetGlyphs (font, scale, scale);
+  uint8_t page;
+
+  // line has to be whole pages of ring
+  if (!glyphs || (RAM_Y_END % glyphs->pages) || (glyphs->pages > lcd->pages)) {
+    // error
+    return SSD1306_ERROR;
+  }
+
+  console->lcd = lcd;
+  console->glyphs = glyphs;
+  console->height = glyphs->pages;
+  console->rows = lcd->pages / glyphs->pages;
+  console->top = 0;
+  console->row = 0;
+  console->column = 0;
+  console->pending = 0;
+
+  // clear whole RAM, hidden pages of 128x32 version included
+  SSD1306_ClearCache (lcd->cacheMemLcd);
+  for (page = START_PAGE_ADDR; page < RAM_Y_END; page++) {
+    SSD1306_MarkRange (lcd, page, START_COLUMN_ADDR, END_COLUMN_ADDR);
+  }
+  SSD1306_SetStartLine (lcd, 0);
+
+  // success
+  return SSD1306_SUCCESS;
+}
+
+/**
+ * @desc    Put character, '\n' new line, '\r' start of line, long lines wrap
+ *
+ * @param   SSD1306_Console *
+ * @param   char
+ *
+ * @return  void
+ */
+void SSD1306_Console_Putc (SSD1306_Console *console, char character)
+{
+  const SSD1306_Glyphs *glyphs = console->glyphs;
+  const SSD1306_Font *font = glyphs->font;
+  const uint8_t *glyph;
+  uint8_t page, p;
+
+  // new line started by next character
+  if ('\n' == character) {
+    // previous new line not started yet
+    if (console->pending) {
+      SSD1306_Console_NewLine (console);
+    }
+    console->pending = 1;
+    return;
+  }
+  // start of line
+  if ('\r' == character) {
+    console->column = 0;
+    return;
+  }
+  // characters out of font are skipped
+  if (((uint8_t) character < font->first) || ((uint8_t) character > font->last)) {
+    return;
+  }
+  // requested new line or character does not fit
+  if (console->pending || (console->column + glyphs->width > RAM_X_END)) {
+    SSD1306_Console_NewLine (console);
+    console->pending = 0;
+  }
+
+  // aligned glyph, page by page
+  glyph = glyphs->glyphs + ((uint8_t) character - font->first) * glyphs->size;
+  page = SSD1306_Console_Page (console, console->row);
+  for (p = 0; p < console->height; p++) {
+    memcpy (console->lcd->cacheMemLcd + CACHE_INDEX (console->column, page + p), glyph + p * glyphs->width, glyphs->width);
+    SSD1306_MarkRange (console->lcd, page + p, console->column, console->column + glyphs->width - 1);
+  }
+  // glyph and space
+  console->column += glyphs->width + glyphs->sx;
+}
+
+/**
+ * @desc    Put string
+ *
+ * @param   SSD1306_Console *
+ * @param   const char *
+ *
+ * @return  void
+ */
+void SSD1306_Console_Write (SSD1306_Console *console, const char *str)
+{
+  // loop through characters
+  while (*str) {
+    SSD1306_Console_Putc (console, *str++);
+  }
+}
+
+#endif
@@ -0,0 +1,78 @@
+/**
+ * -------------------------------------------------------------------------------------+
+ * @desc        SSD1306 Text console
+ * -------------------------------------------------------------------------------------+
+ *              Copyright (C) 2020 Marian Hrinko.
+ *              Written by Marian Hrinko (mato.hrinko@gmail.com)
+ *
+ * @author      Marian Hrinko
+ * @date        17.10.2026
+ * @file        console.h
+ * @version     1.0.0
+ * @tested      Linux
+ *
+ * @depend      ssd1306.h
+ * -------------------------------------------------------------------------------------+
+ * @descr       Pages of GDDRAM (64 rows, also on 128x32 version) are ring of text
+ *              lines. New line is written into next page of ring and start line of
+ *              display is moved by one line, screen content is not moved in RAM.
+ *              New line is started by first character after '\n', so last line
+ *              stays on screen and new line costs one page of data and one
+ *              command on next update.
+ *              Console owns the screen - cache is addressed by RAM pages, so it is
+ *              not available in page-buffer mode (SSD1306_PAGE_BUFFER).
+ * -------------------------------------------------------------------------------------+
+ * @usage       Scrolling text log
+ */
+
+#ifndef __CONSOLE_H__
+#define __CONSOLE_H__
+
+  // @includes
+  #include "ssd1306.h"
+
+  // @struct Console
+  typedef struct {
+    SSD1306_Display *lcd;
+    const SSD1306_Glyphs *glyphs;         // glyphs of console font
+    uint8_t height;                       // pages of line
+    uint8_t rows;                         // lines on screen
+    uint8_t top;                          // RAM page shown on top of screen
+    uint8_t row;                          // line of cursor on screen
+    uint8_t column;                       // column of cursor
+    uint8_t pending;                      // new line requested, done by next character
+  } SSD1306_Console;
+
+  /**
+   * @desc    Init console, screen cleared
+   *
+   * @param   SSD1306_Console *
+   * @param   SSD1306_Display *
+   * @param   const SSD1306_Font *
+   * @param   uint8_t scale 1, 2, 4 (line of whole pages dividing RAM)
+   *
+   * @return  uint8_t
+   */
+  uint8_t SSD1306_Console_Init (SSD1306_Console *, SSD1306_Display *, const SSD1306_Font *, uint8_t);
+
+  /**
+   * @desc    Put character, '\n' new line, '\r' start of line, long lines wrap
+   *
+   * @param   SSD1306_Console *
+   * @param   char
+   *
+   * @return  void
+   */
+  void SSD1306_Console_Putc (SSD1306_Console *, char);
+
+  /**
+   * @desc    Put string
+   *
+   * @param   SSD1306_Console *
+   * @param   const char *
+   *
+   * @return  void
+   */
+  void SSD1306_Console_Write (SSD1306_Console *, const char *);
+
+#endif
@@ -0,0 +1,629 @@
+/**
+ * -------------------------------------------------------------------------------------+
+ * @desc        SSD1306 Transport - in-process SSD1306 emulator
+ * -------------------------------------------------------------------------------------+
+ *              Copyright (C) 2020 Marian Hrinko.
+ *              Written by Marian Hrinko (mato.hrinko@gmail.com)
+ *
+ * @author      Marian Hrinko
+ * @date        17.10.2026
+ * @file        emulator.c
+ * @version     1.0.0
+ * @tested      Linux
+ *
+ * @depend      emulator.h
+ * -------------------------------------------------------------------------------------+
+ * @usage       Testing and benchmarking without display
+ */
+
+// @includes
+#include "emulator.h"
+
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+// Control byte
+// ------------------------------------------------------------------------------------
+#define EMU_CONTROL_CO            0x80  // Continuation bit
+#define EMU_CONTROL_DC            0x40  // Data / Command bit
+#define EMU_CONTROL_NONE          0xFF  // control byte expected
+#define EMU_COMMAND_STREAM        0x00
+#define EMU_DATA_STREAM           0x40
+
+// Addressing modes
+// ------------------------------------------------------------------------------------
+#define EMU_MODE_HORIZONTAL       0x00
+#define EMU_MODE_VERTICAL         0x01
+#define EMU_MODE_PAGE             0x02
+
+// @const frames per scroll step for interval setting 0 ... 7
+static const uint16_t EMU_SCROLL_FRAMES[] = { 5, 64, 128, 256, 3, 4, 25, 2 };
+
+/**
+ * @desc    Monotonic time
+ *
+ * @param   void
+ *
+ * @return  double seconds
+ */
+static double EMU_Now (void)
+{
+  struct timespec now;
+
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  // seconds
+  return now.tv_sec + now.tv_nsec / 1e9;
+}
+
+/**
+ * @desc    Number of arguments of command
+ *
+ * @param   uint8_t command
+ *
+ * @return  uint8_t
+ */
+static uint8_t EMU_Arguments (uint8_t command)
+{
+  switch (command) {
+    case 0x20:                            // memory addressing mode
+    case 0x81:                            // contrast
+    case 0x8D:                            // charge pump
+    case 0xA8:                            // mux ratio
+    case 0xD3:                            // display offset
+    case 0xD5:                            // oscillator frequency
+    case 0xD9:                            // precharge period
+    case 0xDA:                            // COM pins
+    case 0xDB:                            // VCOMH deselect level
+      return 1;
+    case 0x21:                            // column address
+    case 0x22:                            // page address
+    case 0xA3:                            // vertical scroll area
+      return 2;
+    case 0x29:                            // vertical and right horizontal scroll
+    case 0x2A:                            // vertical and left horizontal scroll
+      return 5;
+    case 0x26:                            // right horizontal scroll
+    case 0x27:                            // left horizontal scroll
+      return 6;
+    default:
+      return 0;
+  }
+}
+
+/**
+ * @desc    Apply scroll steps elapsed since last applied step
+ *
+ * @param   SSD1306_Emulator *
+ *
+ * @return  void
+ */
+static void EMU_Scroll (SSD1306_Emulator *emu)
+{
+  // duration of one step, frame time grows with mux ratio
+  double step = (double) EMU_SCROLL_FRAMES[emu->scroll_interval & 0x07] * (emu->mux + 1) / (EMU_FRAME_HZ * EMU_ROWS);
+  double now = EMU_Now ();
+  uint8_t right = (emu->scroll_command == 0x26) || (emu->scroll_command == 0x29);
+  uint8_t rows = emu->scroll_area_rows ? emu->scroll_area_rows : EMU_ROWS;
+  uint8_t page, saved;
+
+  // not active
+  if (!emu->scroll_active) {
+    return;
+  }
+
+  // loop through elapsed steps
+  while (emu->scroll_since + step <= now) {
+    // horizontal part moves content of GDDRAM
+    for (page = emu->scroll_start_page; (page <= emu->scroll_end_page) && (page < EMU_PAGES); page++) {
+      if (right) {
+        saved = emu->gddram[page][EMU_COLUMNS - 1];
+        memmove(&emu->gddram[page][1], &emu->gddram[page][0], EMU_COLUMNS - 1);
+        emu->gddram[page][0] = saved;
+      } else {
+        saved = emu->gddram[page][0];
+        memmove(&emu->gddram[page][0], &emu->gddram[page][1], EMU_COLUMNS - 1);
+        emu->gddram[page][EMU_COLUMNS - 1] = saved;
+      }
+    }
+    // vertical part moves rows of scroll area
+    if (emu->scroll_command > 0x27) {
+      emu->scroll_row = (emu->scroll_row + emu->scroll_vertical) % rows;
+    }
+    emu->scroll_since += step;
+  }
+}
+
+/**
+ * @desc    Execute complete command
+ *
+ * @param   SSD1306_Emulator *
+ *
+ * @return  void
+ */
+static void EMU_Execute (SSD1306_Emulator *emu)
+{
+  uint8_t *c = emu->command;
+
+  // start line 0x40 ... 0x7F
+  if ((c[0] & 0xC0) == 0x40) {
+    emu->start_line = c[0] & 0x3F;
+    return;
+  }
+  // page mode - lower nibble of column 0x00 ... 0x0F
+  if (c[0] <= 0x0F) {
+    emu->column = (emu->column & 0xF0) | c[0];
+    return;
+  }
+  // page mode - upper nibble of column 0x10 ... 0x1F
+  if (c[0] <= 0x1F) {
+    emu->column = (emu->column & 0x0F) | ((c[0] & 0x0F) << 4);
+    return;
+  }
+  // page mode - page 0xB0 ... 0xB7
+  if ((c[0] & 0xF8) == 0xB0) {
+    emu->page = c[0] & 0x07;
+    return;
+  }
+
+  switch (c[0]) {
+    case 0x20: emu->mode = c[1] & 0x03; break;
+    case 0x21: emu->column = emu->column_start = c[1] & 0x7F; emu->column_end = c[2] & 0x7F; break;
+    case 0x22: emu->page = emu->page_start = c[1] & 0x07; emu->page_end = c[2] & 0x07; break;
+    case 0x81: emu->contrast = c[1]; break;
+    case 0x8D: emu->charge_pump = c[1]; break;
+    case 0xA0: emu->seg_remap = 0; break;
+    case 0xA1: emu->seg_remap = 1; break;
+    case 0xA3: emu->scroll_area_top = c[1] & 0x3F; emu->scroll_area_rows = c[2] & 0x7F; break;
+    case 0xA4: emu->entire_on = 0; break;
+    case 0xA5: emu->entire_on = 1; break;
+    case 0xA6: emu->inverse = 0; break;
+    case 0xA7: emu->inverse = 1; break;
+    case 0xA8: emu->mux = c[1] & 0x3F; break;
+    case 0xAE: emu->display_on = 0; break;
+    case 0xAF: emu->display_on = 1; break;
+    case 0xC0: emu->com_remap = 0; break;
+    case 0xC8: emu->com_remap = 1; break;
+    case 0xD3: emu->offset = c[1] & 0x3F; break;
+    case 0xDA: emu->com_pins = c[1]; break;
+    case 0x26:
+    case 0x27:
+    case 0x29:
+    case 0x2A:
+      emu->scroll_command = c[0];
+      emu->scroll_start_page = c[2] & 0x07;
+      emu->scroll_interval = c[3] & 0x07;
+      emu->scroll_end_page = c[4] & 0x07;
+      emu->scroll_vertical = (c[0] > 0x27) ? (c[5] & 0x3F) : 0;
+      break;
+    case 0x2E:
+      // RAM keeps content moved by horizontal scroll
+      EMU_Scroll (emu);
+      emu->scroll_active = 0;
+      emu->scroll_row = 0;
+      break;
+    case 0x2F:
+      emu->scroll_active = 1;
+      emu->scroll_row = 0;
+      emu->scroll_since = EMU_Now ();
+      break;
+    default:
+      // oscillator, precharge, VCOMH and NOP do not change image
+      break;
+  }
+}
+
+/**
+ * @desc    Decode command byte
+ *
+ * @param   SSD1306_Emulator *
+ * @param   uint8_t byte
+ *
+ * @return  void
+ */
+static void EMU_Command (SSD1306_Emulator *emu, uint8_t byte)
+{
+  emu->stats.command_bytes++;
+
+  // first byte of command
+  if (!emu->command_length) {
+    emu->command_needed = EMU_Arguments (byte);
+  }
+  emu->command[emu->command_length++] = byte;
+
+  // command complete
+  if (emu->command_length > emu->command_needed) {
+    EMU_Execute (emu);
+    emu->command_length = 0;
+  }
+}
+
+/**
+ * @desc    Write data byte to GDDRAM and move RAM pointer
+ *
+ * @param   SSD1306_Emulator *
+ * @param   uint8_t byte
+ *
+ * @return  void
+ */
+static void EMU_Data (SSD1306_Emulator *emu, uint8_t byte)
+{
+  emu->stats.data_bytes++;
+  emu->gddram[emu->page & 0x07][emu->column & 0x7F] = byte;
+
+  // horizontal addressing mode
+  if (emu->mode == EMU_MODE_HORIZONTAL) {
+    if (emu->column++ >= emu->column_end) {
+      emu->column = emu->column_start;
+      if (emu->page++ >= emu->page_end) {
+        emu->page = emu->page_start;
+      }
+    }
+  // vertical addressing mode
+  } else if (emu->mode == EMU_MODE_VERTICAL) {
+    if (emu->page++ >= emu->page_end) {
+      emu->page = emu->page_start;
+      if (emu->column++ >= emu->column_end) {
+        emu->column = emu->column_start;
+      }
+    }
+  // page addressing mode
+  } else {
+    emu->column = (emu->column + 1) & 0x7F;
+  }
+}
+
+/**
+ * @desc    Start of write transaction - START and address byte
+ *
+ * @param   SSD1306_Emulator *
+ *
+ * @return  void
+ */
+static void EMU_Start (SSD1306_Emulator *emu)
+{
+  emu->stats.transactions++;
+  // start condition and address byte with acknowledge
+  emu->stats.bus_us += (1 + 9) * 1e6 / emu->bus_hz;
+  // control byte expected
+  emu->control = EMU_CONTROL_NONE;
+}
+
+/**
+ * @desc    Decode bytes of write transaction - control bytes, commands and data
+ *
+ * @param   SSD1306_Emulator *
+ * @param   const uint8_t * bytes
+ * @param   uint16_t length
+ *
+ * @return  void
+ */
+static void EMU_Feed (SSD1306_Emulator *emu, const uint8_t *bytes, uint16_t length)
+{
+  const uint8_t *end = bytes + length;
+
+  emu->stats.bytes += length;
+  // bytes with acknowledge
+  emu->stats.bus_us += length * 9 * 1e6 / emu->bus_hz;
+
+  // loop through bytes
+  while (bytes < end) {
+    // control byte
+    if (emu->control == EMU_CONTROL_NONE) {
+      emu->control = *bytes++;
+      emu->stats.control_bytes++;
+      continue;
+    }
+    // command or data
+    if (emu->control & EMU_CONTROL_DC) {
+      EMU_Data (emu, *bytes++);
+    } else {
+      EMU_Command (emu, *bytes++);
+    }
+    // single byte, control byte follows
+    if (emu->control & EMU_CONTROL_CO) {
+      emu->control = EMU_CONTROL_NONE;
+    }
+  }
+}
+
+/**
+ * @desc    End of write transaction - STOP, blocks caller in realtime mode
+ *
+ * @param   SSD1306_Emulator *
+ * @param   double bus time before transaction [us]
+ *
+ * @return  void
+ */
+static void EMU_Stop (SSD1306_Emulator *emu, double before)
+{
+  // stop condition
+  emu->stats.bus_us += 1e6 / emu->bus_hz;
+  // one call of transport, one USB round trip of pipelined adapter
+  emu->stats.round_trips++;
+
+  // block caller for time spent on bus
+  if (emu->realtime) {
+    usleep((useconds_t) (emu->stats.bus_us - before));
+  }
+}
+
+/**
+ * @desc    Open device
+ *
+ * @param   SSD1306_Transport *
+ *
+ * @return  uint8_t
+ */
+static uint8_t EMU_Open (SSD1306_Transport *transport)
+{
+  // no device behind transport
+  (void) transport;
+  // always present
+  return SSD1306_SUCCESS;
+}
+
+/**
+ * @desc    Write control byte followed by bytes in one transaction
+ *
+ * @param   SSD1306_Transport *
+ * @param   uint8_t address
+ * @param   uint8_t control byte
+ * @param   const uint8_t * bytes
+ * @param   uint16_t length
+ *
+ * @return  uint8_t
+ */
+static uint8_t EMU_Write (SSD1306_Transport *transport, uint8_t address, uint8_t control, const uint8_t *bytes, uint16_t length)
+{
+  SSD1306_Emulator *emu = (SSD1306_Emulator *) transport;
+  double before = emu->stats.bus_us;
+
+  // not acknowledged
+  if (address != emu->address) {
+    return SSD1306_ERROR;
+  }
+
+  EMU_Start (emu);
+  EMU_Feed (emu, &control, 1);
+  EMU_Feed (emu, bytes, length);
+  EMU_Stop (emu, before);
+
+  // success
+  return SSD1306_SUCCESS;
+}
+
+/**
+ * @desc    Write commands
+ *
+ * @param   SSD1306_Transport *
+ * @param   uint8_t address
+ * @param   const uint8_t * commands
+ * @param   uint16_t length
+ *
+ * @return  uint8_t
+ */
+static uint8_t EMU_WriteCommands (SSD1306_Transport *transport, uint8_t address, const uint8_t *commands, uint16_t length)
+{
+  return EMU_Write (transport, address, EMU_COMMAND_STREAM, commands, length);
+}
+
+/**
+ * @desc    Write data
+ *
+ * @param   SSD1306_Transport *
+ * @param   uint8_t address
+ * @param   const uint8_t * data
+ * @param   uint16_t length
+ *
+ * @return  uint8_t
+ */
+static uint8_t EMU_WriteData (SSD1306_Transport *transport, uint8_t address, const uint8_t *data, uint16_t length)
+{
+  return EMU_Write (transport, address, EMU_DATA_STREAM, data, length);
+}
+
+/**
+ * @desc    Write commands and data, repeated start between them
+ *
+ * @param   SSD1306_Transport *
+ * @param   uint8_t address
+ * @param   const uint8_t * commands
+ * @param   uint16_t length of commands
+ * @param   const uint8_t * data
+ * @param   uint16_t length of data
+ *
+ * @return  uint8_t
+ */
+static uint8_t EMU_WriteCommandAndData (SSD1306_Transport *transport, uint8_t address, const uint8_t *commands, uint16_t clength, const uint8_t *data, uint16_t dlength)
+{
+  SSD1306_Emulator *emu = (SSD1306_Emulator *) transport;
+  double before = emu->stats.bus_us;
+  uint8_t control;
+
+  // not acknowledged
+  if (address != emu->address) {
+    return SSD1306_ERROR;
+  }
+
+  // command stream
+  control = EMU_COMMAND_STREAM;
+  EMU_Start (emu);
+  EMU_Feed (emu, &control, 1);
+  EMU_Feed (emu, commands, clength);
+  // data stream
+  control = EMU_DATA_STREAM;
+  EMU_Start (emu);
+  EMU_Feed (emu, &control, 1);
+  EMU_Feed (emu, data, dlength);
+  EMU_Stop (emu, before);
+
+  // success
+  return SSD1306_SUCCESS;
+}
+
+/**
+ * @desc    Write prepared messages, repeated start between them
+ *
+ * @param   SSD1306_Transport *
+ * @param   uint8_t address
+ * @param   const SSD1306_Message * messages
+ * @param   uint16_t number of messages
+ *
+ * @return  uint8_t
+ */
+static uint8_t EMU_WriteMessages (SSD1306_Transport *transport, uint8_t address, const SSD1306_Message *messages, uint16_t count)
+{
+  SSD1306_Emulator *emu = (SSD1306_Emulator *) transport;
+  double before = emu->stats.bus_us;
+
+  // not acknowledged
+  if (address != emu->address) {
+    return SSD1306_ERROR;
+  }
+
+  // loop through messages
+  while (count--) {
+    EMU_Start (emu);
+    EMU_Feed (emu, messages->buffer, messages->length);
+    messages++;
+  }
+  EMU_Stop (emu, before);
+
+  // success
+  return SSD1306_SUCCESS;
+}
+
+/**
+ * @desc    Close device
+ *
+ * @param   SSD1306_Transport *
+ *
+ * @return  void
+ */
+static void EMU_Close (SSD1306_Transport *transport)
+{
+  // nothing to release
+  (void) transport;
+}
+
+// @const Operations
+static const SSD1306_TransportOps EMU_OPS = {
+  EMU_Open,
+  EMU_WriteCommands,
+  EMU_WriteData,
+  EMU_WriteCommandAndData,
+  EMU_WriteMessages,
+  EMU_Close
+};
+
+/**
+ * @desc    Setup emulator transport - controller in reset state
+ *
+ * @param   SSD1306_Emulator *
+ * @param   uint32_t bus clock [Hz]
+ *
+ * @return  SSD1306_Transport *
+ */
+SSD1306_Transport * EMU_Setup (SSD1306_Emulator *emu, uint32_t bus_hz)
+{
+  memset(emu, 0, sizeof(SSD1306_Emulator));
+
+  SSD1306_TransportSetup (&emu->transport, &EMU_OPS, "emu", "emulator", 0xFFFF, TRANSPORT_CAP_SCATTER);
+
+  emu->address = EMU_ADDRESS;
+  emu->bus_hz = bus_hz ? bus_hz : EMU_BUS_HZ;
+  emu->control = EMU_CONTROL_NONE;
+
+  // reset values of controller
+  emu->mode = EMU_MODE_PAGE;
+  emu->column_end = EMU_COLUMNS - 1;
+  emu->page_end = EMU_PAGES - 1;
+  emu->mux = EMU_ROWS - 1;
+  emu->com_pins = 0x12;
+  emu->contrast = 0x7F;
+  emu->scroll_area_rows = EMU_ROWS;
+
+  // common part
+  return &emu->transport;
+}
+
+/**
+ * @desc    Render image visible on the panel
+ *
+ * @param   SSD1306_Emulator *
+ *
+ * @return  void
+ */
+void EMU_Render (SSD1306_Emulator *emu)
+{
+  uint8_t rows = emu->mux + 1;
+  uint8_t row, line, column, x, pixel;
+
+  // content moved by active scroll
+  EMU_Scroll (emu);
+
+  memset(emu->visible, 0, sizeof(emu->visible));
+  // loop through rows of panel
+  for (row = 0; row < rows; row++) {
+    // COM scan direction remap (0xC8) is orientation of mounted module
+    line = emu->com_remap ? row : rows - 1 - row;
+    // start line and offset
+    line = (line + emu->start_line + emu->offset) % EMU_ROWS;
+    // vertical scroll area
+    if ((emu->scroll_command > 0x27) && (row >= emu->scroll_area_top) && (row < emu->scroll_area_top + emu->scroll_area_rows)) {
+      line = (line + emu->scroll_row) % EMU_ROWS;
+    }
+    // loop through columns
+    for (x = 0; x < EMU_COLUMNS; x++) {
+      // segment remap (0xA1) is orientation of mounted module
+      column = emu->seg_remap ? x : EMU_COLUMNS - 1 - x;
+      pixel = (emu->gddram[line >> 3][column] >> (line & 0x07)) & 1;
+      // entire display on, inverse, display off
+      if (emu->entire_on) {
+        pixel = 1;
+      }
+      if (emu->inverse) {
+        pixel ^= 1;
+      }
+      if (!emu->display_on) {
+        pixel = 0;
+      }
+      emu->visible[row][x] = pixel;
+    }
+  }
+}
+
+/**
+ * @desc    Print visible image
+ *
+ * @param   SSD1306_Emulator *
+ * @param   FILE *
+ *
+ * @return  void
+ */
+void EMU_Dump (SSD1306_Emulator *emu, FILE *file)
+{
+  uint8_t row, x;
+
+  EMU_Render (emu);
+  // loop through rows of panel
+  for (row = 0; row <= emu->mux; row++) {
+    for (x = 0; x < EMU_COLUMNS; x++) {
+      fputc(emu->visible[row][x] ? '#' : '.', file);
+    }
+    fputc('\n', file);
+  }
+}
+
+/**
+ * @desc    Reset statistics
+ *
+ * @param   SSD1306_Emulator *
+ *
+ * @return  void
+ */
+void EMU_ResetStats (SSD1306_Emulator *emu)
+{
+  memset(&emu->stats, 0, sizeof(EMU_Stats));
+}
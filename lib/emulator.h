@@ -0,0 +1,141 @@
+/**
+ * -------------------------------------------------------------------------------------+
+ * @desc        SSD1306 Transport - in-process SSD1306 emulator
+ * -------------------------------------------------------------------------------------+
+ *              Copyright (C) 2020 Marian Hrinko.
+ *              Written by Marian Hrinko (mato.hrinko@gmail.com)
+ *
+ * @author      Marian Hrinko
+ * @date        17.10.2026
+ * @file        emulator.h
+ * @version     1.0.0
+ * @tested      Linux
+ *
+ * @depend      transport.h
+ * -------------------------------------------------------------------------------------+
+ * @descr       Decodes control bytes, commands and data sent by the driver into
+ *              simulated 128x64 GDDRAM and renders image visible on the panel
+ *              (start line, offset, remap, inverse, scroll). Counts transactions
+ *              and bytes and models time spent on the bus for given bus clock.
+ * -------------------------------------------------------------------------------------+
+ * @usage       Testing and benchmarking without display
+ */
+
+#ifndef __EMULATOR_H__
+#define __EMULATOR_H__
+
+  // @includes
+  #include <stdio.h>
+  #include "transport.h"
+
+  // Geometry of GDDRAM
+  // ------------------------------------------------------------------------------------
+  #define EMU_PAGES                 8
+  #define EMU_COLUMNS               128
+  #define EMU_ROWS                  (EMU_PAGES * 8)
+
+  // Defaults
+  // ------------------------------------------------------------------------------------
+  #define EMU_ADDRESS               0x3C
+  #define EMU_BUS_HZ                400000
+
+  // Frame rate of panel for 64MUX, default oscillator (0xD5, 0x80) and precharge (0xD9, 0xC2)
+  // ------------------------------------------------------------------------------------
+  #define EMU_FRAME_HZ              90
+
+  // @struct Statistics
+  typedef struct {
+    unsigned long transactions;           // START ... STOP or repeated START
+    unsigned long bytes;                  // bytes behind address byte
+    unsigned long control_bytes;          // control bytes
+    unsigned long command_bytes;          // commands and arguments
+    unsigned long data_bytes;             // GDDRAM data
+    unsigned long round_trips;            // transport calls, USB round trips of pipelined adapter (i2cdriver)
+    double bus_us;                        // time spent on bus
+  } EMU_Stats;
+
+  // @struct Emulator
+  typedef struct {
+    SSD1306_Transport transport;
+    // bus
+    uint8_t address;                      // address of emulated display
+    uint32_t bus_hz;                      // bus clock
+    uint8_t realtime;                     // block caller for time spent on bus
+    EMU_Stats stats;
+    // GDDRAM and visible image, 1 byte per pixel
+    uint8_t gddram[EMU_PAGES][EMU_COLUMNS];
+    uint8_t visible[EMU_ROWS][EMU_COLUMNS];
+    // command decoder
+    uint8_t control;                      // last control byte
+    uint8_t command[8];
+    uint8_t command_length;
+    uint8_t command_needed;
+    // addressing
+    uint8_t mode;                         // 0 horizontal, 1 vertical, 2 page
+    uint8_t column_start, column_end;
+    uint8_t page_start, page_end;
+    uint8_t column, page;                 // RAM pointer
+    // display
+    uint8_t start_line;
+    uint8_t offset;
+    uint8_t mux;
+    uint8_t com_pins;
+    uint8_t seg_remap;
+    uint8_t com_remap;
+    uint8_t inverse;
+    uint8_t entire_on;
+    uint8_t display_on;
+    uint8_t contrast;
+    uint8_t charge_pump;
+    // scroll
+    uint8_t scroll_active;
+    uint8_t scroll_command;               // 0x26, 0x27, 0x29, 0x2A
+    uint8_t scroll_start_page;
+    uint8_t scroll_end_page;
+    uint8_t scroll_interval;              // frames per step
+    uint8_t scroll_vertical;              // vertical offset per step
+    uint8_t scroll_area_top;
+    uint8_t scroll_area_rows;
+    uint8_t scroll_row;                   // vertical scroll position
+    double scroll_since;                  // time of last applied step [s]
+  } SSD1306_Emulator;
+
+  /**
+   * @desc    Setup emulator transport
+   *
+   * @param   SSD1306_Emulator *
+   * @param   uint32_t bus clock [Hz], 0 for EMU_BUS_HZ
+   *
+   * @return  SSD1306_Transport *
+   */
+  SSD1306_Transport * EMU_Setup (SSD1306_Emulator *, uint32_t);
+
+  /**
+   * @desc    Render image visible on the panel into 'visible'
+   *
+   * @param   SSD1306_Emulator *
+   *
+   * @return  void
+   */
+  void EMU_Render (SSD1306_Emulator *);
+
+  /**
+   * @desc    Print visible image
+   *
+   * @param   SSD1306_Emulator *
+   * @param   FILE *
+   *
+   * @return  void
+   */
+  void EMU_Dump (SSD1306_Emulator *, FILE *);
+
+  /**
+   * @desc    Reset statistics
+   *
+   * @param   SSD1306_Emulator *
+   *
+   * @return  void
+   */
+  void EMU_ResetStats (SSD1306_Emulator *);
+
+#endif
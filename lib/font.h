@@ -26,13 +26,18 @@
   // includes
 //  #include <avr/pgmspace.h>
 
+  // no program memory space outside AVR
+  #ifndef PROGMEM
+    #define PROGMEM
+  #endif
+
   // Characters definition
   // -----------------------------------
   // number of columns for chars
-  #define CHARS_COLS_LENGTH  5
+  #define FONT_DEFAULT_WIDTH  5
 
   // @const Characters
-  static const uint8_t FONTS[][CHARS_COLS_LENGTH] PROGMEM = {
+  static const uint8_t FONT_DEFAULT[][FONT_DEFAULT_WIDTH] PROGMEM = {
     { 0x00, 0x00, 0x00, 0x00, 0x00 }, // 20 space
     { 0x81, 0x81, 0x18, 0x81, 0x81 }, // 21 !
     { 0x00, 0x07, 0x00, 0x07, 0x00 }, // 22 "
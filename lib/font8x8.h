@@ -24,16 +24,21 @@
 #define __FONT8x8_H__
 
   // includes
-  #include <avr/pgmspace.h>
+//  #include <avr/pgmspace.h>
+
+  // no program memory space outside AVR
+  #ifndef PROGMEM
+    #define PROGMEM
+  #endif
 
   // Characters definition
   // -----------------------------------
   // number of columns for chars
-  #define CHARS_COLS_LENGTH  8
+  #define FONT_8X8_WIDTH      8
 
   // @author basti79
   // @source https://github.com/basti79/LCD-fonts/blob/master/8x8_vertikal_LSB_1.h
-  static const uint8_t FONTS[][CHARS_COLS_LENGTH] PROGMEM = {
+  static const uint8_t FONT_8X8[][FONT_8X8_WIDTH] PROGMEM = {
     {0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},	// 0x20
     {0x00,0x06,0x5F,0x5F,0x06,0x00,0x00,0x00},	// 0x21
     {0x00,0x07,0x07,0x00,0x07,0x07,0x00,0x00},	// 0x22
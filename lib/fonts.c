@@ -0,0 +1,220 @@
+/**
+ * -------------------------------------------------------------------------------------+
+ * @desc        SSD1306 Font registry
+ * -------------------------------------------------------------------------------------+
+ *              Copyright (C) 2020 Marian Hrinko.
+ *              Written by Marian Hrinko (mato.hrinko@gmail.com)
+ *
+ * @author      Marian Hrinko
+ * @date        17.10.2026
+ * @file        fonts.c
+ * @version     1.0.0
+ * @tested      Linux
+ *
+ * @depend      fonts.h, font.h, font5x8.h, font6x8.h, font8x8.h
+ * -------------------------------------------------------------------------------------+
+ * @usage       Text in several fonts and sizes
+ */
+
+// @includes
+#include "fonts.h"
+#include "font.h"
+#include "font5x8.h"
+#include "font6x8.h"
+#include "font8x8.h"
+
+#include <pthread.h>
+#include <stdlib.h>
+#include <string.h>
+
+// @const Success / Error
+#ifndef SSD1306_SUCCESS
+  #define SSD1306_SUCCESS         0
+#endif
+#ifndef SSD1306_ERROR
+  #define SSD1306_ERROR           1
+#endif
+
+// @const Fonts compiled in, characters 0x20 ... 0x7F
+const SSD1306_Font SSD1306_FONT_DEFAULT = { "default", &FONT_DEFAULT[0][0], FONT_DEFAULT_WIDTH, 8, 0x20, 0x7F };
+const SSD1306_Font SSD1306_FONT_5X8 = { "5x8", &FONT_5X8[0][0], FONT_5X8_WIDTH, 8, 0x20, 0x7F };
+const SSD1306_Font SSD1306_FONT_6X8 = { "6x8", &FONT_6X8[0][0], FONT_6X8_WIDTH, 8, 0x20, 0x7F };
+const SSD1306_Font SSD1306_FONT_8X8 = { "8x8", &FONT_8X8[0][0], FONT_8X8_WIDTH, 8, 0x20, 0x7F };
+
+// @var registered fonts
+static const SSD1306_Font *fonts[FONTS_MAX] = {
+  &SSD1306_FONT_DEFAULT,
+  &SSD1306_FONT_5X8,
+  &SSD1306_FONT_6X8,
+  &SSD1306_FONT_8X8
+};
+// @var number of registered fonts
+static uint8_t fontsCount = 4;
+
+// @var expanded font / scale pairs
+static SSD1306_Glyphs cache[FONTS_CACHE_MAX];
+// @var number of expanded pairs
+static uint8_t cacheCount;
+
+// @var lock of registry and cache
+static pthread_mutex_t fontsLock = PTHREAD_MUTEX_INITIALIZER;
+
+/**
+ * @desc    Register font
+ *
+ * @param   const SSD1306_Font *
+ *
+ * @return  uint8_t
+ */
+uint8_t SSD1306_RegisterFont (const SSD1306_Font *font)
+{
+  // status
+  uint8_t status = SSD1306_ERROR;
+
+  pthread_mutex_lock (&fontsLock);
+  // free slot
+  if (fontsCount < FONTS_MAX) {
+    fonts[fontsCount++] = font;
+    status = SSD1306_SUCCESS;
+  }
+  pthread_mutex_unlock (&fontsLock);
+
+  // status
+  return status;
+}
+
+/**
+ * @desc    Find font by name
+ *
+ * @param   const char *
+ *
+ * @return  const SSD1306_Font * or NULL
+ */
+const SSD1306_Font * SSD1306_FindFont (const char *name)
+{
+  const SSD1306_Font *font = NULL;
+  uint8_t i;
+
+  pthread_mutex_lock (&fontsLock);
+  for (i = 0; i < fontsCount; i++) {
+    if (!strcmp (fonts[i]->name, name)) {
+      font = fonts[i];
+      break;
+    }
+  }
+  pthread_mutex_unlock (&fontsLock);
+
+  // font
+  return font;
+}
+
+/**
+ * @desc    Expand glyphs of font by scale, every column repeated 'sx' times and every
+ *          row 'sy' times
+ *
+ * @param   SSD1306_Glyphs * with font and scale set
+ *
+ * @return  uint8_t
+ */
+static uint8_t SSD1306_ExpandGlyphs (SSD1306_Glyphs *expanded)
+{
+  const SSD1306_Font *font = expanded->font;
+  // pages of source glyph
+  uint8_t pages = (font->height + 7) >> 3;
+  // source glyph
+  const uint8_t *glyph;
+  // destination glyph
+  uint8_t *out;
+  // column of source and expanded glyph
+  uint64_t column, tall;
+  uint16_t c;
+  uint8_t i, p, r, s;
+
+  // expanded column has to fit 64 bits
+  if (font->height * expanded->sy > 64) {
+    // error
+    return SSD1306_ERROR;
+  }
+
+  expanded->width = font->width * expanded->sx;
+  expanded->pages = (font->height * expanded->sy + 7) >> 3;
+  expanded->size = expanded->width * expanded->pages;
+  expanded->glyphs = malloc ((font->last - font->first + 1) * expanded->size);
+  // out of memory
+  if (!expanded->glyphs) {
+    // error
+    return SSD1306_ERROR;
+  }
+
+  // loop through characters
+  for (c = 0; c <= font->last - font->first; c++) {
+    glyph = font->glyphs + c * font->width * pages;
+    out = expanded->glyphs + c * expanded->size;
+    // loop through columns
+    for (i = 0; i < font->width; i++) {
+      // column of source glyph
+      column = 0;
+      for (p = 0; p < pages; p++) {
+        column |= (uint64_t) glyph[p * font->width + i] << (p << 3);
+      }
+      // every row 'sy' times
+      tall = 0;
+      for (r = 0; r < font->height; r++) {
+        if (column & ((uint64_t) 1 << r)) {
+          tall |= (((uint64_t) 1 << expanded->sy) - 1) << (r * expanded->sy);
+        }
+      }
+      // every column 'sx' times
+      for (s = 0; s < expanded->sx; s++) {
+        for (p = 0; p < expanded->pages; p++) {
+          out[p * expanded->width + i * expanded->sx + s] = tall >> (p << 3);
+        }
+      }
+    }
+  }
+
+  // success
+  return SSD1306_SUCCESS;
+}
+
+/**
+ * @desc    Get glyphs of font expanded by scale, expanded on first use
+ *
+ * @param   const SSD1306_Font *
+ * @param   uint8_t horizontal scale
+ * @param   uint8_t vertical scale
+ *
+ * @return  const SSD1306_Glyphs * or NULL
+ */
+const SSD1306_Glyphs * SSD1306_GetGlyphs (const SSD1306_Font *font, uint8_t sx, uint8_t sy)
+{
+  SSD1306_Glyphs *expanded = NULL;
+  uint8_t i;
+
+  // scale out of range
+  if (!sx || !sy || (sx > FONTS_SCALE_MAX) || (sy > FONTS_SCALE_MAX)) {
+    return NULL;
+  }
+
+  pthread_mutex_lock (&fontsLock);
+  // expanded before
+  for (i = 0; i < cacheCount; i++) {
+    if ((cache[i].font == font) && (cache[i].sx == sx) && (cache[i].sy == sy)) {
+      expanded = &cache[i];
+      break;
+    }
+  }
+  // expand on first use
+  if (!expanded && (cacheCount < FONTS_CACHE_MAX)) {
+    cache[cacheCount].font = font;
+    cache[cacheCount].sx = sx;
+    cache[cacheCount].sy = sy;
+    if (SSD1306_SUCCESS == SSD1306_ExpandGlyphs (&cache[cacheCount])) {
+      expanded = &cache[cacheCount++];
+    }
+  }
+  pthread_mutex_unlock (&fontsLock);
+
+  // expanded glyphs
+  return expanded;
+}
@@ -0,0 +1,92 @@
+/**
+ * -------------------------------------------------------------------------------------+
+ * @desc        SSD1306 Font registry
+ * -------------------------------------------------------------------------------------+
+ *              Copyright (C) 2020 Marian Hrinko.
+ *              Written by Marian Hrinko (mato.hrinko@gmail.com)
+ *
+ * @author      Marian Hrinko
+ * @date        17.10.2026
+ * @file        fonts.h
+ * @version     1.0.0
+ * @tested      Linux
+ *
+ * @depend      stdint.h
+ * -------------------------------------------------------------------------------------+
+ * @descr       Fonts compiled in (font.h, font5x8.h, font6x8.h, font8x8.h) coexist,
+ *              further fonts can be registered at runtime. Glyphs of every font and
+ *              scale pair are expanded once on first use into page-major columns,
+ *              so drawing a character is a copy of ready-made bytes.
+ * -------------------------------------------------------------------------------------+
+ * @usage       Text in several fonts and sizes
+ */
+
+#ifndef __FONTS_H__
+#define __FONTS_H__
+
+  // @includes
+  #include <stdint.h>
+
+  // Limits
+  // ------------------------------------------------------------------------------------
+  #define FONTS_MAX                 16    // registered fonts
+  #define FONTS_SCALE_MAX           4     // integer scale factor 1 ... 4
+  #define FONTS_CACHE_MAX           32    // expanded font / scale pairs
+
+  // @struct Font - glyph is 'width' columns of ((height + 7) / 8) pages, page-major
+  typedef struct {
+    const char *name;
+    const uint8_t *glyphs;                // glyphs from 'first' to 'last'
+    uint8_t width;                        // columns of glyph
+    uint8_t height;                       // rows of glyph
+    uint8_t first;                        // first character
+    uint8_t last;                         // last character
+  } SSD1306_Font;
+
+  // @struct Glyphs - glyphs of font expanded by scale
+  typedef struct {
+    const SSD1306_Font *font;
+    uint8_t sx;                           // horizontal scale
+    uint8_t sy;                           // vertical scale
+    uint8_t width;                        // columns of expanded glyph
+    uint8_t pages;                        // pages of expanded glyph
+    uint16_t size;                        // bytes of expanded glyph
+    uint8_t *glyphs;
+  } SSD1306_Glyphs;
+
+  // @const Fonts compiled in
+  extern const SSD1306_Font SSD1306_FONT_DEFAULT;
+  extern const SSD1306_Font SSD1306_FONT_5X8;
+  extern const SSD1306_Font SSD1306_FONT_6X8;
+  extern const SSD1306_Font SSD1306_FONT_8X8;
+
+  /**
+   * @desc    Register font
+   *
+   * @param   const SSD1306_Font *
+   *
+   * @return  uint8_t
+   */
+  uint8_t SSD1306_RegisterFont (const SSD1306_Font *);
+
+  /**
+   * @desc    Find font by name
+   *
+   * @param   const char *
+   *
+   * @return  const SSD1306_Font * or NULL
+   */
+  const SSD1306_Font * SSD1306_FindFont (const char *);
+
+  /**
+   * @desc    Get glyphs of font expanded by scale, expanded on first use
+   *
+   * @param   const SSD1306_Font *
+   * @param   uint8_t horizontal scale
+   * @param   uint8_t vertical scale
+   *
+   * @return  const SSD1306_Glyphs * or NULL
+   */
+  const SSD1306_Glyphs * SSD1306_GetGlyphs (const SSD1306_Font *, uint8_t, uint8_t);
+
+#endif
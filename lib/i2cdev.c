@@ -0,0 +1,400 @@
+/**
+ * -------------------------------------------------------------------------------------+
+ * @desc        SSD1306 Transport - Linux i2c-dev
+ * -------------------------------------------------------------------------------------+
+ *              Copyright (C) 2020 Marian Hrinko.
+ *              Written by Marian Hrinko (mato.hrinko@gmail.com)
+ *
+ * @author      Marian Hrinko
+ * @date        17.10.2026
+ * @file        i2cdev.c
+ * @version     1.0.0
+ * @tested      Linux i2c-dev
+ *
+ * @depend      i2cdev.h
+ * -------------------------------------------------------------------------------------+
+ * @usage       Transport through /dev/i2c-N and I2C_RDWR ioctl
+ */
+
+// @includes
+#include "i2cdev.h"
+
+#if USE_I2C_DEVICE
+
+#include <fcntl.h>
+#include <linux/i2c.h>
+#include <linux/i2c-dev.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/ioctl.h>
+#include <unistd.h>
+
+// Control bytes
+// ------------------------------------------------------------------------------------
+#define I2CDEV_COMMAND_STREAM     0x00
+#define I2CDEV_DATA_STREAM        0x40
+#define I2CDEV_CONTINUATION       0x80  // control byte followed by one byte and next control byte
+
+// Limits
+// ------------------------------------------------------------------------------------
+#define I2CDEV_MAX_MESSAGES       I2C_RDWR_IOCTL_MAX_MSGS
+#define I2CDEV_MAX_BLOCK          I2C_SMBUS_BLOCK_MAX     // data bytes of SMBus block write
+
+/**
+ * @desc    Transfer messages by one ioctl
+ *
+ * @param   SSD1306_I2cDev *
+ * @param   struct i2c_msg *
+ * @param   uint16_t number of messages
+ *
+ * @return  uint8_t
+ */
+static uint8_t I2CDEV_Transfer (SSD1306_I2cDev *dev, struct i2c_msg *messages, uint16_t count)
+{
+  struct i2c_rdwr_ioctl_data ioctl_data = { messages, count };
+
+  // send messages
+  if (ioctl(dev->fd, I2C_RDWR, &ioctl_data) != count)
+  {
+    perror("failed to write i2c messages");
+    return SSD1306_ERROR;
+  }
+
+  // success
+  return SSD1306_SUCCESS;
+}
+
+/**
+ * @desc    Write control byte and up to I2CDEV_MAX_BLOCK bytes by SMBus I2C block write
+ *
+ * @param   SSD1306_I2cDev *
+ * @param   uint8_t address
+ * @param   uint8_t control byte
+ * @param   const uint8_t * bytes
+ * @param   uint8_t length
+ *
+ * @return  uint8_t
+ */
+static uint8_t I2CDEV_Block (SSD1306_I2cDev *dev, uint8_t address, uint8_t control, const uint8_t *bytes, uint8_t length)
+{
+  union i2c_smbus_data data;
+  struct i2c_smbus_ioctl_data ioctl_data = { I2C_SMBUS_WRITE, control, I2C_SMBUS_I2C_BLOCK_DATA, &data };
+
+  // SMBus transfers go to slave address of device
+  if (dev->address != address)
+  {
+    if (ioctl(dev->fd, I2C_SLAVE, address) < 0)
+    {
+      perror("failed to set i2c slave address");
+      return SSD1306_ERROR;
+    }
+    dev->address = address;
+  }
+
+  // length and bytes
+  data.block[0] = length;
+  memcpy(data.block + 1, bytes, length);
+
+  // send block
+  if (ioctl(dev->fd, I2C_SMBUS, &ioctl_data) < 0)
+  {
+    perror("failed to write i2c block");
+    return SSD1306_ERROR;
+  }
+
+  // success
+  return SSD1306_SUCCESS;
+}
+
+/**
+ * @desc    Write control byte followed by bytes by SMBus blocks, next blocks repeat
+ *          control byte of stream - continuation control bytes with their bytes
+ *          in front of stream go in first block only
+ *
+ * @param   SSD1306_I2cDev *
+ * @param   uint8_t address
+ * @param   uint8_t control byte
+ * @param   const uint8_t * bytes
+ * @param   uint16_t length
+ *
+ * @return  uint8_t
+ */
+static uint8_t I2CDEV_Blocks (SSD1306_I2cDev *dev, uint8_t address, uint8_t control, const uint8_t *bytes, uint16_t length)
+{
+  // control byte of stream
+  uint8_t stream = control;
+  uint16_t i;
+  uint8_t part;
+
+  // pairs of continuation control byte and byte lead to stream
+  for (i = 1; (stream & I2CDEV_CONTINUATION) && (i < length); i += 2) {
+    stream = bytes[i];
+  }
+  // pairs have to fit into first block
+  if ((control & I2CDEV_CONTINUATION) && (i - 1 > I2CDEV_MAX_BLOCK)) {
+    fprintf(stderr, "continuation control bytes exceed i2c block\n");
+    return SSD1306_ERROR;
+  }
+
+  // loop through blocks
+  while (length) {
+    part = length < I2CDEV_MAX_BLOCK ? length : I2CDEV_MAX_BLOCK;
+    if (SSD1306_SUCCESS != I2CDEV_Block (dev, address, control, bytes, part)) {
+      // error
+      return SSD1306_ERROR;
+    }
+    // stream continues
+    control = stream;
+    bytes += part;
+    length -= part;
+  }
+
+  // success
+  return SSD1306_SUCCESS;
+}
+
+/**
+ * @desc    Open device
+ *
+ * @param   SSD1306_Transport *
+ *
+ * @return  uint8_t
+ */
+static uint8_t I2CDEV_Open (SSD1306_Transport *transport)
+{
+  SSD1306_I2cDev *dev = (SSD1306_I2cDev *) transport;
+
+  dev->fd = open(transport->device, O_RDWR);
+  if (dev->fd == -1)
+  {
+    perror("could not open i2c device");
+    return SSD1306_ERROR;
+  }
+
+  // capabilities of adapter
+  if (ioctl(dev->fd, I2C_FUNCS, &dev->funcs) < 0)
+  {
+    perror("failed to get i2c adapter functionality");
+    close(dev->fd);
+    dev->fd = -1;
+    return SSD1306_ERROR;
+  }
+  // plain I2C - messages of any length by I2C_RDWR
+  if (dev->funcs & I2C_FUNC_I2C) {
+    dev->smbus = 0;
+  // SMBus only - I2C blocks, message of control byte and one block
+  } else if (dev->funcs & I2C_FUNC_SMBUS_WRITE_I2C_BLOCK) {
+    dev->smbus = 1;
+    dev->address = 0xFF;
+    transport->max_transfer = I2CDEV_MAX_BLOCK + 1;
+  } else {
+    fprintf(stderr, "i2c adapter supports neither I2C nor SMBus block writes\n");
+    close(dev->fd);
+    dev->fd = -1;
+    return SSD1306_ERROR;
+  }
+
+  // success
+  return SSD1306_SUCCESS;
+}
+
+/**
+ * @desc    Write control byte followed by bytes
+ *
+ * @param   SSD1306_Transport *
+ * @param   uint8_t address
+ * @param   uint8_t control byte
+ * @param   const uint8_t * bytes
+ * @param   uint16_t length
+ *
+ * @return  uint8_t
+ */
+static uint8_t I2CDEV_Write (SSD1306_Transport *transport, uint8_t address, uint8_t control, const uint8_t *bytes, uint16_t length)
+{
+  SSD1306_I2cDev *dev = (SSD1306_I2cDev *) transport;
+  uint8_t buffer[length + 1];
+  struct i2c_msg message = { address, 0, length + 1, buffer };
+
+  // SMBus adapter
+  if (dev->smbus) {
+    return I2CDEV_Blocks (dev, address, control, bytes, length);
+  }
+
+  // control byte
+  buffer[0] = control;
+  memcpy(buffer + 1, bytes, length);
+
+  // send message
+  return I2CDEV_Transfer (dev, &message, 1);
+}
+
+/**
+ * @desc    Write commands
+ *
+ * @param   SSD1306_Transport *
+ * @param   uint8_t address
+ * @param   const uint8_t * commands
+ * @param   uint16_t length
+ *
+ * @return  uint8_t
+ */
+static uint8_t I2CDEV_WriteCommands (SSD1306_Transport *transport, uint8_t address, const uint8_t *commands, uint16_t length)
+{
+  return I2CDEV_Write (transport, address, I2CDEV_COMMAND_STREAM, commands, length);
+}
+
+/**
+ * @desc    Write data
+ *
+ * @param   SSD1306_Transport *
+ * @param   uint8_t address
+ * @param   const uint8_t * data
+ * @param   uint16_t length
+ *
+ * @return  uint8_t
+ */
+static uint8_t I2CDEV_WriteData (SSD1306_Transport *transport, uint8_t address, const uint8_t *data, uint16_t length)
+{
+  return I2CDEV_Write (transport, address, I2CDEV_DATA_STREAM, data, length);
+}
+
+/**
+ * @desc    Write commands and data by one ioctl
+ *
+ * @param   SSD1306_Transport *
+ * @param   uint8_t address
+ * @param   const uint8_t * commands
+ * @param   uint16_t length of commands
+ * @param   const uint8_t * data
+ * @param   uint16_t length of data
+ *
+ * @return  uint8_t
+ */
+static uint8_t I2CDEV_WriteCommandAndData (SSD1306_Transport *transport, uint8_t address, const uint8_t *commands, uint16_t clength, const uint8_t *data, uint16_t dlength)
+{
+  SSD1306_I2cDev *dev = (SSD1306_I2cDev *) transport;
+  uint8_t cbuffer[clength + 1];
+  uint8_t dbuffer[dlength + 1];
+  struct i2c_msg messages[] = {
+    { address, 0, clength + 1, cbuffer },
+    { address, 0, dlength + 1, dbuffer }
+  };
+
+  // SMBus adapter
+  if (dev->smbus) {
+    if (SSD1306_SUCCESS != I2CDEV_Blocks (dev, address, I2CDEV_COMMAND_STREAM, commands, clength)) {
+      // error
+      return SSD1306_ERROR;
+    }
+    return I2CDEV_Blocks (dev, address, I2CDEV_DATA_STREAM, data, dlength);
+  }
+
+  // command stream
+  cbuffer[0] = I2CDEV_COMMAND_STREAM;
+  memcpy(cbuffer + 1, commands, clength);
+  // data stream
+  dbuffer[0] = I2CDEV_DATA_STREAM;
+  memcpy(dbuffer + 1, data, dlength);
+
+  // send messages
+  return I2CDEV_Transfer (dev, messages, 2);
+}
+
+/**
+ * @desc    Write prepared messages, up to I2CDEV_MAX_MESSAGES by one ioctl,
+ *          one SMBus block write per message on SMBus adapter
+ *
+ * @param   SSD1306_Transport *
+ * @param   uint8_t address
+ * @param   const SSD1306_Message * messages
+ * @param   uint16_t number of messages
+ *
+ * @return  uint8_t
+ */
+static uint8_t I2CDEV_WriteMessages (SSD1306_Transport *transport, uint8_t address, const SSD1306_Message *messages, uint16_t count)
+{
+  SSD1306_I2cDev *dev = (SSD1306_I2cDev *) transport;
+  struct i2c_msg batch[I2CDEV_MAX_MESSAGES];
+  uint16_t i = 0;
+
+  // SMBus adapter - control byte of message is SMBus command
+  while (dev->smbus && count) {
+    if (SSD1306_SUCCESS != I2CDEV_Blocks (dev, address, messages->buffer[0], messages->buffer + 1, messages->length - 1)) {
+      // error
+      return SSD1306_ERROR;
+    }
+    messages++;
+    count--;
+  }
+
+  // loop through messages
+  while (count) {
+    // message
+    batch[i].addr = address;
+    batch[i].flags = 0;
+    batch[i].len = messages->length;
+    batch[i].buf = (uint8_t *) messages->buffer;
+    messages++;
+    count--;
+    // batch full or last message
+    if ((++i == I2CDEV_MAX_MESSAGES) || !count) {
+      if (SSD1306_SUCCESS != I2CDEV_Transfer (dev, batch, i)) {
+        // error
+        return SSD1306_ERROR;
+      }
+      i = 0;
+    }
+  }
+
+  // success
+  return SSD1306_SUCCESS;
+}
+
+/**
+ * @desc    Close device
+ *
+ * @param   SSD1306_Transport *
+ *
+ * @return  void
+ */
+static void I2CDEV_Close (SSD1306_Transport *transport)
+{
+  SSD1306_I2cDev *dev = (SSD1306_I2cDev *) transport;
+
+  if (dev->fd != -1) {
+    close(dev->fd);
+    dev->fd = -1;
+  }
+}
+
+// @const Operations
+static const SSD1306_TransportOps I2CDEV_OPS = {
+  I2CDEV_Open,
+  I2CDEV_WriteCommands,
+  I2CDEV_WriteData,
+  I2CDEV_WriteCommandAndData,
+  I2CDEV_WriteMessages,
+  I2CDEV_Close
+};
+
+/**
+ * @desc    Setup i2c-dev transport
+ *
+ * @param   SSD1306_I2cDev *
+ * @param   const char * device path
+ *
+ * @return  SSD1306_Transport *
+ */
+SSD1306_Transport * I2CDEV_Setup (SSD1306_I2cDev *dev, const char *device)
+{
+  SSD1306_TransportSetup (&dev->transport, &I2CDEV_OPS, "i2c-dev", device ? device : I2CDEV_DEVICE, I2CDEV_MAX_TRANSFER, TRANSPORT_CAP_SCATTER);
+  dev->fd = -1;
+  dev->funcs = 0;
+  dev->smbus = 0;
+  dev->address = 0xFF;
+
+  // common part
+  return &dev->transport;
+}
+
+#endif
@@ -0,0 +1,59 @@
+/**
+ * -------------------------------------------------------------------------------------+
+ * @desc        SSD1306 Transport - Linux i2c-dev
+ * -------------------------------------------------------------------------------------+
+ *              Copyright (C) 2020 Marian Hrinko.
+ *              Written by Marian Hrinko (mato.hrinko@gmail.com)
+ *
+ * @author      Marian Hrinko
+ * @date        17.10.2026
+ * @file        i2cdev.h
+ * @version     1.0.0
+ * @tested      Linux i2c-dev
+ *
+ * @depend      transport.h
+ * -------------------------------------------------------------------------------------+
+ * @descr       Adapter capabilities are read by I2C_FUNCS on open. Adapter with plain
+ *              I2C gets all messages of update by one I2C_RDWR ioctl (up to
+ *              I2C_RDWR_IOCTL_MAX_MSGS), adapter with SMBus only gets I2C block
+ *              writes of 32 bytes, control byte as SMBus command.
+ * -------------------------------------------------------------------------------------+
+ * @usage       Transport through /dev/i2c-N and I2C_RDWR ioctl
+ */
+
+#ifndef __I2CDEV_H__
+#define __I2CDEV_H__
+
+  // @includes
+  #include "transport.h"
+
+  // Default device
+  // ------------------------------------------------------------------------------------
+  #define I2CDEV_DEVICE             "/dev/i2c-1"
+
+  // Limits
+  // ------------------------------------------------------------------------------------
+  #ifndef I2CDEV_MAX_TRANSFER
+    #define I2CDEV_MAX_TRANSFER     8192  // max bytes of one i2c_msg, lower for adapters splitting long messages
+  #endif
+
+  // @struct Linux i2c-dev transport
+  typedef struct {
+    SSD1306_Transport transport;
+    int fd;
+    unsigned long funcs;                  // I2C_FUNC_* of adapter
+    uint8_t smbus;                        // adapter without plain I2C, SMBus block writes
+    uint8_t address;                      // slave address of SMBus transfers
+  } SSD1306_I2cDev;
+
+  /**
+   * @desc    Setup i2c-dev transport
+   *
+   * @param   SSD1306_I2cDev *
+   * @param   const char * device path, NULL for I2CDEV_DEVICE
+   *
+   * @return  SSD1306_Transport *
+   */
+  SSD1306_Transport * I2CDEV_Setup (SSD1306_I2cDev *, const char *);
+
+#endif
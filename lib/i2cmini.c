@@ -0,0 +1,447 @@
+/**
+ * -------------------------------------------------------------------------------------+
+ * @desc        SSD1306 Transport - i2cdriver / i2cmini
+ * -------------------------------------------------------------------------------------+
+ *              Copyright (C) 2020 Marian Hrinko.
+ *              Written by Marian Hrinko (mato.hrinko@gmail.com)
+ *
+ * @author      Marian Hrinko
+ * @date        17.10.2026
+ * @file        i2cmini.c
+ * @version     1.0.0
+ * @tested      i2cdriver
+ *
+ * @depend      i2cmini.h
+ * -------------------------------------------------------------------------------------+
+ * @usage       Transport through i2cdriver USB adapter
+ */
+
+// @includes
+#include "i2cmini.h"
+
+#if USE_I2CMINI
+
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+
+// Control bytes
+// ------------------------------------------------------------------------------------
+#define I2CMINI_COMMAND_STREAM    0x00
+#define I2CMINI_DATA_STREAM       0x40
+
+// Adapter commands
+// ------------------------------------------------------------------------------------
+#define I2CMINI_START             's'   // address byte follows, 1 byte response
+#define I2CMINI_WRITE             0xC0  // + (n - 1), n = 1 ... 64 bytes follow, 1 byte response
+#define I2CMINI_STOP              'p'
+#define I2CMINI_SPEED_100         '1'
+#define I2CMINI_SPEED_400         '4'
+#define I2CMINI_MAX_WRITE         64
+
+/**
+ * @desc    Send pipe by one write and read responses, ACK status in bit 0
+ *
+ * @param   SSD1306_I2cMini *
+ *
+ * @return  uint8_t
+ */
+static uint8_t I2CMINI_Sync (SSD1306_I2cMini *mini)
+{
+  uint8_t responses[I2CMINI_PIPE_SIZE / 2];
+  uint8_t status = SSD1306_SUCCESS;
+  uint16_t done = 0;
+  ssize_t n;
+
+  // send pipe
+  while (done < mini->length) {
+    n = write(mini->i2c.port, mini->pipe + done, mini->length - done);
+    if (n <= 0) {
+      perror("failed to write to i2cdriver");
+      status = SSD1306_ERROR;
+      break;
+    }
+    done += n;
+  }
+  // read all responses at once
+  done = 0;
+  while ((SSD1306_SUCCESS == status) && (done < mini->responses)) {
+    n = read(mini->i2c.port, responses + done, mini->responses - done);
+    if (n <= 0) {
+      perror("failed to read from i2cdriver");
+      status = SSD1306_ERROR;
+      break;
+    }
+    done += n;
+  }
+  // round trip
+  if (mini->responses) {
+    mini->round_trips++;
+  }
+  // not acknowledged
+  while ((SSD1306_SUCCESS == status) && done--) {
+    if (!(responses[done] & 1)) {
+      fprintf(stderr, "i2c write not acknowledged\n");
+      status = SSD1306_ERROR;
+    }
+  }
+  // empty pipe
+  mini->length = 0;
+  mini->responses = 0;
+
+  // status
+  return status;
+}
+
+/**
+ * @desc    Make room in pipe, full pipe is sent
+ *
+ * @param   SSD1306_I2cMini *
+ * @param   uint16_t bytes needed
+ *
+ * @return  uint8_t
+ */
+static uint8_t I2CMINI_Room (SSD1306_I2cMini *mini, uint16_t length)
+{
+  // bus stays open, transfer continues with next pipe
+  if (mini->length + length > I2CMINI_PIPE_SIZE) {
+    return I2CMINI_Sync (mini);
+  }
+
+  // success
+  return SSD1306_SUCCESS;
+}
+
+/**
+ * @desc    Pipe start (repeated start) of write
+ *
+ * @param   SSD1306_I2cMini *
+ * @param   uint8_t address
+ *
+ * @return  uint8_t
+ */
+static uint8_t I2CMINI_Start (SSD1306_I2cMini *mini, uint8_t address)
+{
+  if (SSD1306_SUCCESS != I2CMINI_Room (mini, 2)) {
+    // error
+    return SSD1306_ERROR;
+  }
+  mini->pipe[mini->length++] = I2CMINI_START;
+  mini->pipe[mini->length++] = address << 1;
+  mini->responses++;
+
+  // success
+  return SSD1306_SUCCESS;
+}
+
+/**
+ * @desc    Pipe bytes of transaction, control byte in front if any
+ *
+ * @param   SSD1306_I2cMini *
+ * @param   const uint8_t * control byte, NULL if part of bytes
+ * @param   const uint8_t * bytes
+ * @param   uint16_t length
+ *
+ * @return  uint8_t
+ */
+static uint8_t I2CMINI_Bytes (SSD1306_I2cMini *mini, const uint8_t *control, const uint8_t *bytes, uint16_t length)
+{
+  uint16_t total = length + (control ? 1 : 0);
+  uint16_t part;
+
+  // loop through writes of adapter
+  while (total) {
+    part = total < I2CMINI_MAX_WRITE ? total : I2CMINI_MAX_WRITE;
+    if (SSD1306_SUCCESS != I2CMINI_Room (mini, part + 1)) {
+      // error
+      return SSD1306_ERROR;
+    }
+    mini->pipe[mini->length++] = I2CMINI_WRITE + part - 1;
+    total -= part;
+    // control byte opens first write
+    if (control) {
+      mini->pipe[mini->length++] = *control;
+      control = NULL;
+      part--;
+    }
+    memcpy(mini->pipe + mini->length, bytes, part);
+    mini->length += part;
+    mini->responses++;
+    bytes += part;
+  }
+
+  // success
+  return SSD1306_SUCCESS;
+}
+
+/**
+ * @desc    Pipe stop and send pipe
+ *
+ * @param   SSD1306_I2cMini *
+ *
+ * @return  uint8_t
+ */
+static uint8_t I2CMINI_Stop (SSD1306_I2cMini *mini)
+{
+  if (SSD1306_SUCCESS != I2CMINI_Room (mini, 1)) {
+    // error
+    return SSD1306_ERROR;
+  }
+  mini->pipe[mini->length++] = I2CMINI_STOP;
+
+  // one round trip
+  return I2CMINI_Sync (mini);
+}
+
+/**
+ * @desc    Abort transfer after error - piped bytes are dropped and stop is sent,
+ *          bus addressed by pipe sent before error is released
+ *
+ * @param   SSD1306_I2cMini *
+ *
+ * @return  void
+ */
+static void I2CMINI_Abort (SSD1306_I2cMini *mini)
+{
+  // drop pipe
+  mini->length = 0;
+  mini->responses = 0;
+  // stop alone, error of transfer is reported by caller
+  mini->pipe[mini->length++] = I2CMINI_STOP;
+  I2CMINI_Sync (mini);
+}
+
+/**
+ * @desc    Send bus clock to adapter
+ *
+ * @param   SSD1306_I2cMini *
+ *
+ * @return  uint8_t
+ */
+static uint8_t I2CMINI_Speed (SSD1306_I2cMini *mini)
+{
+  mini->pipe[mini->length++] = (100 == mini->speed) ? I2CMINI_SPEED_100 : I2CMINI_SPEED_400;
+
+  // no response
+  return I2CMINI_Sync (mini);
+}
+
+/**
+ * @desc    Open device
+ *
+ * @param   SSD1306_Transport *
+ *
+ * @return  uint8_t
+ */
+static uint8_t I2CMINI_Open (SSD1306_Transport *transport)
+{
+  SSD1306_I2cMini *mini = (SSD1306_I2cMini *) transport;
+
+  i2c_connect(&mini->i2c, transport->device);
+  if (!mini->i2c.connected)
+  {
+    perror("could not open i2cdriver");
+    return SSD1306_ERROR;
+  }
+
+  // bus clock
+  return I2CMINI_Speed (mini);
+}
+
+/**
+ * @desc    Write control byte followed by bytes in one transaction
+ *
+ * @param   SSD1306_Transport *
+ * @param   uint8_t address
+ * @param   uint8_t control byte
+ * @param   const uint8_t * bytes
+ * @param   uint16_t length
+ *
+ * @return  uint8_t
+ */
+static uint8_t I2CMINI_Write (SSD1306_Transport *transport, uint8_t address, uint8_t control, const uint8_t *bytes, uint16_t length)
+{
+  SSD1306_I2cMini *mini = (SSD1306_I2cMini *) transport;
+
+  if ((SSD1306_SUCCESS != I2CMINI_Start (mini, address)) ||
+      (SSD1306_SUCCESS != I2CMINI_Bytes (mini, &control, bytes, length))) {
+    // error
+    I2CMINI_Abort (mini);
+    return SSD1306_ERROR;
+  }
+
+  // send
+  return I2CMINI_Stop (mini);
+}
+
+/**
+ * @desc    Write commands
+ *
+ * @param   SSD1306_Transport *
+ * @param   uint8_t address
+ * @param   const uint8_t * commands
+ * @param   uint16_t length
+ *
+ * @return  uint8_t
+ */
+static uint8_t I2CMINI_WriteCommands (SSD1306_Transport *transport, uint8_t address, const uint8_t *commands, uint16_t length)
+{
+  return I2CMINI_Write (transport, address, I2CMINI_COMMAND_STREAM, commands, length);
+}
+
+/**
+ * @desc    Write data
+ *
+ * @param   SSD1306_Transport *
+ * @param   uint8_t address
+ * @param   const uint8_t * data
+ * @param   uint16_t length
+ *
+ * @return  uint8_t
+ */
+static uint8_t I2CMINI_WriteData (SSD1306_Transport *transport, uint8_t address, const uint8_t *data, uint16_t length)
+{
+  return I2CMINI_Write (transport, address, I2CMINI_DATA_STREAM, data, length);
+}
+
+/**
+ * @desc    Write commands and data, repeated start between them
+ *
+ * @param   SSD1306_Transport *
+ * @param   uint8_t address
+ * @param   const uint8_t * commands
+ * @param   uint16_t length of commands
+ * @param   const uint8_t * data
+ * @param   uint16_t length of data
+ *
+ * @return  uint8_t
+ */
+static uint8_t I2CMINI_WriteCommandAndData (SSD1306_Transport *transport, uint8_t address, const uint8_t *commands, uint16_t clength, const uint8_t *data, uint16_t dlength)
+{
+  SSD1306_I2cMini *mini = (SSD1306_I2cMini *) transport;
+  const uint8_t command = I2CMINI_COMMAND_STREAM;
+  const uint8_t stream = I2CMINI_DATA_STREAM;
+
+  if ((SSD1306_SUCCESS != I2CMINI_Start (mini, address)) ||
+      (SSD1306_SUCCESS != I2CMINI_Bytes (mini, &command, commands, clength)) ||
+      (SSD1306_SUCCESS != I2CMINI_Start (mini, address)) ||
+      (SSD1306_SUCCESS != I2CMINI_Bytes (mini, &stream, data, dlength))) {
+    // error
+    I2CMINI_Abort (mini);
+    return SSD1306_ERROR;
+  }
+
+  // send
+  return I2CMINI_Stop (mini);
+}
+
+/**
+ * @desc    Write prepared messages, repeated start between them, one round trip
+ *
+ * @param   SSD1306_Transport *
+ * @param   uint8_t address
+ * @param   const SSD1306_Message * messages
+ * @param   uint16_t number of messages
+ *
+ * @return  uint8_t
+ */
+static uint8_t I2CMINI_WriteMessages (SSD1306_Transport *transport, uint8_t address, const SSD1306_Message *messages, uint16_t count)
+{
+  SSD1306_I2cMini *mini = (SSD1306_I2cMini *) transport;
+
+  // loop through messages
+  while (count--) {
+    if ((SSD1306_SUCCESS != I2CMINI_Start (mini, address)) ||
+        (SSD1306_SUCCESS != I2CMINI_Bytes (mini, NULL, messages->buffer, messages->length))) {
+      // error
+      I2CMINI_Abort (mini);
+      return SSD1306_ERROR;
+    }
+    messages++;
+  }
+
+  // send
+  return I2CMINI_Stop (mini);
+}
+
+/**
+ * @desc    Close device
+ *
+ * @param   SSD1306_Transport *
+ *
+ * @return  void
+ */
+static void I2CMINI_Close (SSD1306_Transport *transport)
+{
+  SSD1306_I2cMini *mini = (SSD1306_I2cMini *) transport;
+
+  // i2cdriver library has no disconnect, close serial port
+  if (mini->i2c.connected) {
+    close(mini->i2c.port);
+    mini->i2c.connected = 0;
+  }
+}
+
+// @const Operations
+static const SSD1306_TransportOps I2CMINI_OPS = {
+  I2CMINI_Open,
+  I2CMINI_WriteCommands,
+  I2CMINI_WriteData,
+  I2CMINI_WriteCommandAndData,
+  I2CMINI_WriteMessages,
+  I2CMINI_Close
+};
+
+/**
+ * @desc    Setup i2cdriver transport
+ *
+ * @param   SSD1306_I2cMini *
+ * @param   const char * device path
+ *
+ * @return  SSD1306_Transport *
+ */
+SSD1306_Transport * I2CMINI_Setup (SSD1306_I2cMini *mini, const char *device)
+{
+  SSD1306_TransportSetup (&mini->transport, &I2CMINI_OPS, "i2cdriver", device ? device : I2CMINI_DEVICE, 0xFFFF, TRANSPORT_CAP_SCATTER);
+  mini->i2c.connected = 0;
+  mini->speed = I2CMINI_SPEED;
+  mini->length = 0;
+  mini->responses = 0;
+  mini->round_trips = 0;
+
+  // common part
+  return &mini->transport;
+}
+
+/**
+ * @desc    Set bus clock, sent on open if device is not open yet
+ *
+ * @param   SSD1306_I2cMini *
+ * @param   uint16_t bus clock [kHz], 100 or 400
+ *
+ * @return  uint8_t
+ */
+uint8_t I2CMINI_SetSpeed (SSD1306_I2cMini *mini, uint16_t speed)
+{
+  // status
+  uint8_t status = SSD1306_SUCCESS;
+
+  // adapter knows 100 and 400 kHz only
+  if ((100 != speed) && (400 != speed)) {
+    // error
+    return SSD1306_ERROR;
+  }
+
+  pthread_mutex_lock (&mini->transport.lock);
+  mini->speed = speed;
+  // opened device
+  if (mini->i2c.connected) {
+    status = I2CMINI_Speed (mini);
+  }
+  pthread_mutex_unlock (&mini->transport.lock);
+
+  // status
+  return status;
+}
+
+#endif
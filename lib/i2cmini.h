@@ -0,0 +1,82 @@
+/**
+ * -------------------------------------------------------------------------------------+
+ * @desc        SSD1306 Transport - i2cdriver / i2cmini
+ * -------------------------------------------------------------------------------------+
+ *              Copyright (C) 2020 Marian Hrinko.
+ *              Written by Marian Hrinko (mato.hrinko@gmail.com)
+ *
+ * @author      Marian Hrinko
+ * @date        17.10.2026
+ * @file        i2cmini.h
+ * @version     1.0.0
+ * @tested      i2cdriver
+ *
+ * @depend      transport.h, i2cdriver.h
+ * -------------------------------------------------------------------------------------+
+ * @descr       Adapter protocol is spoken directly over serial port. Starts, writes
+ *              and stops of one operation are pipelined into one USB write and
+ *              responses (ACK status) are read back at once, so every operation
+ *              costs one USB round trip instead of one per start and 64 bytes.
+ * -------------------------------------------------------------------------------------+
+ * @usage       Transport through i2cdriver USB adapter
+ */
+
+#ifndef __I2CMINI_H__
+#define __I2CMINI_H__
+
+  // @includes
+  #include "transport.h"
+
+#if USE_I2CMINI
+
+  // @includes
+  #include "i2cdriver.h"
+
+  // Default device
+  // ------------------------------------------------------------------------------------
+  #define I2CMINI_DEVICE            "/dev/ttyUSB0"
+
+  // Bus clock [kHz], 100 or 400
+  // ------------------------------------------------------------------------------------
+  #ifndef I2CMINI_SPEED
+    #define I2CMINI_SPEED           400
+  #endif
+
+  // Pipelined stream
+  // ------------------------------------------------------------------------------------
+  #define I2CMINI_PIPE_SIZE         4096  // bytes of adapter commands sent by one write
+
+  // @struct i2cdriver transport
+  typedef struct {
+    SSD1306_Transport transport;
+    I2CDriver i2c;
+    uint16_t speed;                       // bus clock [kHz]
+    uint8_t pipe[I2CMINI_PIPE_SIZE];      // adapter commands not sent yet
+    uint16_t length;                      // length of pipe
+    uint16_t responses;                   // responses expected for pipe
+    unsigned long round_trips;            // USB writes waiting for responses
+  } SSD1306_I2cMini;
+
+  /**
+   * @desc    Setup i2cdriver transport
+   *
+   * @param   SSD1306_I2cMini *
+   * @param   const char * device path, NULL for I2CMINI_DEVICE
+   *
+   * @return  SSD1306_Transport *
+   */
+  SSD1306_Transport * I2CMINI_Setup (SSD1306_I2cMini *, const char *);
+
+  /**
+   * @desc    Set bus clock, sent on open if device is not open yet
+   *
+   * @param   SSD1306_I2cMini *
+   * @param   uint16_t bus clock [kHz], 100 or 400
+   *
+   * @return  uint8_t
+   */
+  uint8_t I2CMINI_SetSpeed (SSD1306_I2cMini *, uint16_t);
+
+#endif
+
+#endif
@@ -0,0 +1,116 @@
+/**
+ * -------------------------------------------------------------------------------------+
+ * @desc        SSD1306 Page flipping on 128x32 version
+ * -------------------------------------------------------------------------------------+
+ *              Copyright (C) 2020 Marian Hrinko.
+ *              Written by Marian Hrinko (mato.hrinko@gmail.com)
+ *
+ * @author      Marian Hrinko
+ * @date        17.10.2026
+ * @file        pageflip.c
+ * @version     1.0.0
+ * @tested      Linux
+ *
+ * @depend      pageflip.h
+ * -------------------------------------------------------------------------------------+
+ * @usage       Double buffered animation on 128x32 version
+ */
+
+// @includes
+#include "pageflip.h"
+
+// frame is copied between halves of cache, not built in page-buffer mode
+#ifndef SSD1306_PAGE_BUFFER
+
+/**
+ * @desc    Init page flipping, 128x32 version only, visible half shown
+ *
+ * @param   SSD1306_PageFlip *
+ * @param   SSD1306_Display *
+ *
+ * @return  uint8_t
+ */
+uint8_t SSD1306_PageFlip_Init (SSD1306_PageFlip *flip, SSD1306_Display *lcd)
+{
+  // hidden half of RAM only on 128x32 version, scroll moves pages
+  if (((lcd->pages << 1) != RAM_Y_END) || lcd->scrollActive) {
+    // error
+    return SSD1306_ERROR;
+  }
+
+  flip->lcd = lcd;
+  flip->front = START_PAGE_ADDR;
+  flip->flips = 0;
+
+  // first half shown from next update
+  SSD1306_SetStartLine (lcd, START_PAGE_ADDR << 3);
+
+  // success
+  return SSD1306_SUCCESS;
+}
+
+/**
+ * @desc    Present frame drawn into visible pages of cache - frame is written into
+ *          hidden half of RAM, then start line shows it
+ *
+ * @param   SSD1306_PageFlip *
+ *
+ * @return  uint8_t
+ */
+uint8_t SSD1306_PageFlip_Present (SSD1306_PageFlip *flip)
+{
+  SSD1306_Display *lcd = flip->lcd;
+  // hidden half of RAM
+  uint8_t back = flip->front ^ lcd->pages;
+  uint8_t page;
+  // status
+  uint8_t status;
+
+  // content has to be acknowledged before switch, not queued in open transaction
+  if (lcd->batchDepth) {
+    // error
+    return SSD1306_ERROR;
+  }
+
+  // changes of drawn pages go to hidden half only
+  SSD1306_MarkScreen (lcd, 0);
+  // front half shown, start line sent again only after failed switch
+  SSD1306_SetStartLine (lcd, flip->front << 3);
+  status = SSD1306_UpdateScreen (lcd);
+  // request succesfull
+  if (SSD1306_SUCCESS != status) {
+    // error
+    return status;
+  }
+
+  // frame into hidden half of cache, frame is drawn into first half
+  if (back) {
+    memcpy (lcd->cacheMemLcd + back * PAGE_SIZE_MEM, lcd->cacheMemLcd, lcd->pages * PAGE_SIZE_MEM);
+  }
+  // changed bytes against frame sent into hidden half before
+  for (page = back; page < back + lcd->pages; page++) {
+    SSD1306_MarkRange (lcd, page, START_COLUMN_ADDR, END_COLUMN_ADDR);
+  }
+  status = SSD1306_UpdateScreen (lcd);
+  // request succesfull
+  if (SSD1306_SUCCESS != status) {
+    // error
+    return status;
+  }
+
+  // whole frame in RAM, one command shows it
+  SSD1306_SetStartLine (lcd, back << 3);
+  status = SSD1306_UpdateScreen (lcd);
+  // request succesfull
+  if (SSD1306_SUCCESS != status) {
+    // error
+    return status;
+  }
+  flip->front = back;
+  flip->flips++;
+
+  // success
+  return SSD1306_SUCCESS;
+}
+
+#endif
@@ -0,0 +1,62 @@
+/**
+ * -------------------------------------------------------------------------------------+
+ * @desc        SSD1306 Page flipping on 128x32 version
+ * -------------------------------------------------------------------------------------+
+ *              Copyright (C) 2020 Marian Hrinko.
+ *              Written by Marian Hrinko (mato.hrinko@gmail.com)
+ *
+ * @author      Marian Hrinko
+ * @date        17.10.2026
+ * @file        pageflip.h
+ * @version     1.0.0
+ * @tested      Linux
+ *
+ * @depend      ssd1306.h
+ * -------------------------------------------------------------------------------------+
+ * @descr       128x32 version shows 4 of 8 pages of GDDRAM, other half holds next
+ *              frame. Frame drawn into visible pages of cache is written into hidden
+ *              half and shown by one start line command (0x40 / 0x60) sent only after
+ *              all content is acknowledged, so half sent frame is never visible, also
+ *              on pipelined adapter. Only changed bytes against frame sent into the
+ *              same half before are sent.
+ *              Page flip owns the start line, console and vertical scroll can not be
+ *              used together with it. Not available in page-buffer mode
+ *              (SSD1306_PAGE_BUFFER), both halves are frames of cache.
+ * -------------------------------------------------------------------------------------+
+ * @usage       Double buffered animation on 128x32 version
+ */
+
+#ifndef __PAGEFLIP_H__
+#define __PAGEFLIP_H__
+
+  // @includes
+  #include "ssd1306.h"
+
+  // @struct Page flip
+  typedef struct {
+    SSD1306_Display *lcd;
+    uint8_t front;                        // first RAM page shown on display
+    unsigned long flips;                  // presented frames
+  } SSD1306_PageFlip;
+
+  /**
+   * @desc    Init page flipping, 128x32 version only, visible half shown
+   *
+   * @param   SSD1306_PageFlip *
+   * @param   SSD1306_Display *
+   *
+   * @return  uint8_t
+   */
+  uint8_t SSD1306_PageFlip_Init (SSD1306_PageFlip *, SSD1306_Display *);
+
+  /**
+   * @desc    Present frame drawn into visible pages of cache - frame is written into
+   *          hidden half of RAM, then start line shows it
+   *
+   * @param   SSD1306_PageFlip *
+   *
+   * @return  uint8_t
+   */
+  uint8_t SSD1306_PageFlip_Present (SSD1306_PageFlip *);
+
+#endif
@@ -0,0 +1,148 @@
+/**
+ * -------------------------------------------------------------------------------------+
+ * @desc        SSD1306 Frame scheduler
+ * -------------------------------------------------------------------------------------+
+ *              Copyright (C) 2020 Marian Hrinko.
+ *              Written by Marian Hrinko (mato.hrinko@gmail.com)
+ *
+ * @author      Marian Hrinko
+ * @date        17.10.2026
+ * @file        scheduler.c
+ * @version     1.0.0
+ * @tested      Linux
+ *
+ * @depend      scheduler.h
+ * -------------------------------------------------------------------------------------+
+ * @usage       Pacing of frames
+ */
+
+// @includes
+#include "scheduler.h"
+
+#include <errno.h>
+
+// @const nanoseconds per second
+#define SCHEDULER_NSEC            1000000000L
+
+/**
+ * @desc    Difference of times
+ *
+ * @param   const struct timespec * later
+ * @param   const struct timespec * earlier
+ *
+ * @return  double [us]
+ */
+static double SSD1306_Scheduler_Diff (const struct timespec *later, const struct timespec *earlier)
+{
+  return (later->tv_sec - earlier->tv_sec) * 1e6 + (later->tv_nsec - earlier->tv_nsec) / 1e3;
+}
+
+/**
+ * @desc    Move time by number of intervals
+ *
+ * @param   struct timespec *
+ * @param   uint32_t interval [us]
+ * @param   uint32_t number of intervals
+ *
+ * @return  void
+ */
+static void SSD1306_Scheduler_Advance (struct timespec *time, uint32_t interval_us, uint32_t count)
+{
+  // interval in nanoseconds
+  uint64_t ns = (uint64_t) interval_us * 1000 * count + time->tv_nsec;
+
+  time->tv_sec += ns / SCHEDULER_NSEC;
+  time->tv_nsec = ns % SCHEDULER_NSEC;
+}
+
+/**
+ * @desc    Start scheduler, first frame starts now
+ *
+ * @param   SSD1306_Scheduler *
+ * @param   uint32_t frame interval [us]
+ *
+ * @return  void
+ */
+void SSD1306_Scheduler_Start (SSD1306_Scheduler *scheduler, uint32_t interval_us)
+{
+  scheduler->interval_us = interval_us;
+  scheduler->render_us = 0;
+  scheduler->flush_us = 0;
+  scheduler->slack_us = 0;
+  scheduler->frames = 0;
+  scheduler->overruns = 0;
+  scheduler->skipped = 0;
+
+  // first frame
+  clock_gettime (CLOCK_MONOTONIC, &scheduler->start);
+  scheduler->rendered = scheduler->start;
+  scheduler->deadline = scheduler->start;
+  SSD1306_Scheduler_Advance (&scheduler->deadline, interval_us, 1);
+}
+
+/**
+ * @desc    Mark end of render of current frame
+ *
+ * @param   SSD1306_Scheduler *
+ *
+ * @return  void
+ */
+void SSD1306_Scheduler_Rendered (SSD1306_Scheduler *scheduler)
+{
+  clock_gettime (CLOCK_MONOTONIC, &scheduler->rendered);
+  scheduler->render_us = SSD1306_Scheduler_Diff (&scheduler->rendered, &scheduler->start);
+}
+
+/**
+ * @desc    Mark end of flush of current frame
+ *
+ * @param   SSD1306_Scheduler *
+ *
+ * @return  void
+ */
+void SSD1306_Scheduler_Flushed (SSD1306_Scheduler *scheduler)
+{
+  struct timespec now;
+
+  clock_gettime (CLOCK_MONOTONIC, &now);
+  scheduler->flush_us = SSD1306_Scheduler_Diff (&now, &scheduler->rendered);
+}
+
+/**
+ * @desc    Finish frame and sleep until start of next frame
+ *
+ * @param   SSD1306_Scheduler *
+ *
+ * @return  uint32_t number of skipped deadlines
+ */
+uint32_t SSD1306_Scheduler_Wait (SSD1306_Scheduler *scheduler)
+{
+  struct timespec now;
+  // skipped deadlines
+  uint32_t skip = 0;
+
+  // time left to deadline
+  clock_gettime (CLOCK_MONOTONIC, &now);
+  scheduler->slack_us = SSD1306_Scheduler_Diff (&scheduler->deadline, &now);
+  scheduler->frames++;
+
+  // deadline missed
+  if (scheduler->slack_us < 0) {
+    // next deadline in grid
+    skip = (uint32_t) (-scheduler->slack_us / scheduler->interval_us) + 1;
+    SSD1306_Scheduler_Advance (&scheduler->deadline, scheduler->interval_us, skip);
+    scheduler->overruns++;
+    scheduler->skipped += skip;
+  }
+
+  // sleep until deadline, restart after signal
+  while (EINTR == clock_nanosleep (CLOCK_MONOTONIC, TIMER_ABSTIME, &scheduler->deadline, NULL));
+
+  // next frame
+  clock_gettime (CLOCK_MONOTONIC, &scheduler->start);
+  scheduler->rendered = scheduler->start;
+  SSD1306_Scheduler_Advance (&scheduler->deadline, scheduler->interval_us, 1);
+
+  // skipped deadlines
+  return skip;
+}
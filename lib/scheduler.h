@@ -0,0 +1,85 @@
+/**
+ * -------------------------------------------------------------------------------------+
+ * @desc        SSD1306 Frame scheduler
+ * -------------------------------------------------------------------------------------+
+ *              Copyright (C) 2020 Marian Hrinko.
+ *              Written by Marian Hrinko (mato.hrinko@gmail.com)
+ *
+ * @author      Marian Hrinko
+ * @date        17.10.2026
+ * @file        scheduler.h
+ * @version     1.0.0
+ * @tested      Linux
+ *
+ * @depend      stdint.h, time.h
+ * -------------------------------------------------------------------------------------+
+ * @descr       Frames start on deadlines of fixed interval counted on monotonic clock,
+ *              so render and transfer time do not shift refresh rate. Frame that
+ *              overruns its deadline skips missed deadlines and next frame starts on
+ *              next deadline in grid. Render time, flush time and slack of every
+ *              frame are recorded.
+ * -------------------------------------------------------------------------------------+
+ * @usage       Pacing of frames
+ */
+
+#ifndef __SCHEDULER_H__
+#define __SCHEDULER_H__
+
+  // @includes
+  #include <stdint.h>
+  #include <time.h>
+
+  // @struct Scheduler
+  typedef struct {
+    uint32_t interval_us;                 // target frame interval
+    struct timespec deadline;             // end of current frame
+    struct timespec start;                // start of current frame
+    struct timespec rendered;             // end of render of current frame
+    // last frame
+    double render_us;                     // start -> SSD1306_Scheduler_Rendered
+    double flush_us;                      // SSD1306_Scheduler_Rendered -> SSD1306_Scheduler_Flushed
+    double slack_us;                      // time left to deadline, negative on overrun
+    // statistics
+    unsigned long frames;                 // finished frames
+    unsigned long overruns;               // frames that missed deadline
+    unsigned long skipped;                // deadlines skipped by overruns
+  } SSD1306_Scheduler;
+
+  /**
+   * @desc    Start scheduler, first frame starts now
+   *
+   * @param   SSD1306_Scheduler *
+   * @param   uint32_t frame interval [us]
+   *
+   * @return  void
+   */
+  void SSD1306_Scheduler_Start (SSD1306_Scheduler *, uint32_t);
+
+  /**
+   * @desc    Mark end of render of current frame
+   *
+   * @param   SSD1306_Scheduler *
+   *
+   * @return  void
+   */
+  void SSD1306_Scheduler_Rendered (SSD1306_Scheduler *);
+
+  /**
+   * @desc    Mark end of flush of current frame
+   *
+   * @param   SSD1306_Scheduler *
+   *
+   * @return  void
+   */
+  void SSD1306_Scheduler_Flushed (SSD1306_Scheduler *);
+
+  /**
+   * @desc    Finish frame and sleep until start of next frame
+   *
+   * @param   SSD1306_Scheduler *
+   *
+   * @return  uint32_t number of skipped deadlines
+   */
+  uint32_t SSD1306_Scheduler_Wait (SSD1306_Scheduler *);
+
+#endif
@@ -1,10 +1,6 @@
 #define pgm_read_byte *
 typedef unsigned char uint8_t;
 #define PROGMEM
-unsigned int _counter;
-
-#define USE_I2C_DEVICE 0
-#define USE_I2CMINI 1
 
 /**
  * --------------------------------------------------------------------------------------+
@@ -15,7 +11,7 @@ unsigned int _counter;
  *
  * @author      Marian Hrinko
  * @date        06.10.2020
- * @update      06.12.2022
+ * @update      17.10.2026
  * @file        ssd1306.c
  * @version     2.0.0
  * @tested      AVR Atmega328p
@@ -32,22 +28,10 @@ unsigned int _counter;
 // @includes
 #include "ssd1306.h"
 
-#include <fcntl.h>
-#include <linux/i2c.h>
-#include <linux/i2c-dev.h>
+#include <pthread.h>
 #include <stdint.h>
 #include <stdio.h>
-#include <sys/ioctl.h>
-#include <unistd.h>
 #include <sys/types.h>
-#include <sys/stat.h>
-#include <fcntl.h> 
-#include <arpa/inet.h>
-#include <stdlib.h>
-
-#if USE_I2CMINI
-  #include "i2cdriver.h"
-#endif
 
 // +---------------------------+
 // |      Set MUX Ratio        |
@@ -154,25 +138,427 @@ const uint8_t INIT_SSD1306[] PROGMEM = {
   0, SSD1306_DISPLAY_ON                                           // 0xAF = Set Display ON
 };
 
-// @var array Chache memory Lcd 8 * 128 = 1024
-static char cacheMemLcd[CACHE_SIZE_MEM];
+// @const bits of page byte from row y % 8 down to bottom of page
+static const uint8_t TOP_MASK[8] = { 0xFF, 0xFE, 0xFC, 0xF8, 0xF0, 0xE0, 0xC0, 0x80 };
+// @const bits of page byte from top of page down to row y % 8
+static const uint8_t BOTTOM_MASK[8] = { 0x01, 0x03, 0x07, 0x0F, 0x1F, 0x3F, 0x7F, 0xFF };
+
+// @const drawing mode replacing area of object
+#define SSD1306_MODE_COPY         0x04
+// @const text replaces glyph cell in SSD1306_MODE_SET
+#define SSD1306_TEXT_MODE(mode)   ((SSD1306_MODE_SET == (mode)) ? SSD1306_MODE_COPY : (mode))
+
+// @const step of cache pointer between pages, 0 in page-buffer mode
+#define CACHE_STRIDE              (CACHE_INDEX (0, 1) - CACHE_INDEX (0, 0))
+
+#ifdef SSD1306_PAGE_BUFFER
+// @const drawing calls recorded into display list
+#define SSD1306_BAND_IDLE         0xFF
+// @const recorded call not drawn, pages it marks are binned
+#define SSD1306_BAND_NONE         0xFE
+// @const recorded drawing functions
+#define SSD1306_OP_PIXEL          0x00
+#define SSD1306_OP_FILL           0x01
+#define SSD1306_OP_LINE           0x02
+#define SSD1306_OP_STRING         0x03
+#define SSD1306_OP_TEXT           0x04
+#define SSD1306_OP_BITMAP         0x05
+#define SSD1306_OP_BMP            0x06
+#endif
+
+// @const frames per scroll step for interval setting 0 ... 7
+static const uint16_t SCROLL_FRAMES[8] = { 5, 64, 128, 256, 3, 4, 25, 2 };
 
-#if USE_I2C_DEVICE
-  static int fd = -1;
+// @const bytes needed to open an update window (command stream of 6 commands + data control byte)
+#define WINDOW_COST               (1 + 6 + 1)
+// @const address byte of every message of update
+#define MESSAGE_COST              1
+// @const bytes needed to switch addressing mode (command and argument joining command stream)
+#define MODE_COST                 2
+// @const max runs of one update, runs of page are more than WINDOW_COST apart
+#define WINDOWS_MAX               (RAM_Y_END * (RAM_X_END / (WINDOW_COST + 2) + 1))
+
+/**
+ * @desc    SSD1306 Mark column range of page as dirty
+ *
+ * @param   SSD1306_Display *
+ * @param   uint8_t page
+ * @param   uint8_t start column
+ * @param   uint8_t end column
+ *
+ * @return  void
+ */
+static inline void SSD1306_MarkDirty (SSD1306_Display *lcd, uint8_t page, uint8_t start, uint8_t end)
+{
+  // page out of RAM
+  if (page >= RAM_Y_END) {
+    return;
+  }
+  // clip end column
+  if (end > END_COLUMN_ADDR) {
+    end = END_COLUMN_ADDR;
+  }
+  // extend range
+  if (start < lcd->dirtyStart[page]) {
+    lcd->dirtyStart[page] = start;
+  }
+  if (end > lcd->dirtyEnd[page]) {
+    lcd->dirtyEnd[page] = end;
+  }
+#ifdef SSD1306_PAGE_BUFFER
+  // page of recorded call
+  lcd->touched |= 1 << page;
 #endif
+}
+
+/**
+ * @desc    SSD1306 Mark whole screen as dirty / clean
+ *
+ * @param   SSD1306_Display *
+ * @param   uint8_t dirty
+ *
+ * @return  void
+ */
+void SSD1306_MarkScreen (SSD1306_Display *lcd, uint8_t dirty)
+{
+  // empty range
+  memset (lcd->dirtyStart, 0xFF, RAM_Y_END);
+  memset (lcd->dirtyEnd, 0x00, RAM_Y_END);
+  // whole range of visible pages
+  if (dirty) {
+    memset (lcd->dirtyStart, START_COLUMN_ADDR, lcd->pages);
+    memset (lcd->dirtyEnd, END_COLUMN_ADDR, lcd->pages);
+  }
+}
+
+/**
+ * @desc    SSD1306 Mark column range of page as dirty, any page of RAM
+ *
+ * @param   SSD1306_Display *
+ * @param   uint8_t page
+ * @param   uint8_t start column
+ * @param   uint8_t end column
+ *
+ * @return  void
+ */
+void SSD1306_MarkRange (SSD1306_Display *lcd, uint8_t page, uint8_t start, uint8_t end)
+{
+  // extend range
+  SSD1306_MarkDirty (lcd, page, start, end);
+}
+
+/**
+ * @desc    SSD1306 Clear frame, control byte slots of pages set to data stream
+ *
+ * @param   uint8_t * frame of CACHE_SIZE_MEM bytes
+ *
+ * @return  void
+ */
+void SSD1306_ClearCache (uint8_t *frame)
+{
+  uint8_t page;
+
+  // null frame
+  memset (frame, 0x00, CACHE_SIZE_MEM);
+  // control byte in front of every page
+  for (page = START_PAGE_ADDR; page < CACHE_PAGES; page++) {
+    frame[page * PAGE_SIZE_MEM] = SSD1306_DATA_STREAM;
+  }
+}
+
+/**
+ * @desc    SSD1306 Page moved by horizontal scroll, RAM of page is not written while scrolling
+ *
+ * @param   SSD1306_Display *
+ * @param   uint8_t page
+ *
+ * @return  uint8_t
+ */
+static inline uint8_t SSD1306_Scrolled (SSD1306_Display *lcd, uint8_t page)
+{
+  // page in range of running scroll
+  return lcd->scrollActive && (page >= lcd->scrollStart) && (page <= lcd->scrollEnd);
+}
 
-#if USE_I2CMINI
-  I2CDriver i2c;
+/**
+ * @desc    SSD1306 Page of cache written by drawing, in page-buffer mode only page being
+ *          rendered, columns are marked dirty also on other pages
+ *
+ * @param   SSD1306_Display *
+ * @param   int16_t page
+ *
+ * @return  uint8_t
+ */
+static inline uint8_t SSD1306_Band (SSD1306_Display *lcd, int16_t page)
+{
+#ifdef SSD1306_PAGE_BUFFER
+  // page rendered
+  return lcd->band == page;
+#else
+  // whole frame in cache
+  (void) lcd;
+  (void) page;
+  return 1;
 #endif
+}
+
+/**
+ * @desc    SSD1306 Copy short run of bytes, fixed size moves instead of string instructions
+ *
+ * @param   uint8_t * destination
+ * @param   const uint8_t * source
+ * @param   int16_t length
+ *
+ * @return  void
+ */
+static inline void SSD1306_Copy (uint8_t *dst, const uint8_t *src, int16_t length)
+{
+  // 8 bytes at once
+  while (length >= 8) {
+    memcpy (dst, src, 8);
+    dst += 8;
+    src += 8;
+    length -= 8;
+  }
+  // rest
+  if (length & 4) {
+    memcpy (dst, src, 4);
+    dst += 4;
+    src += 4;
+  }
+  if (length & 2) {
+    memcpy (dst, src, 2);
+    dst += 2;
+    src += 2;
+  }
+  if (length & 1) {
+    *dst = *src;
+  }
+}
+
+/**
+ * @desc    SSD1306 Flip run of bytes, 8 bytes at once
+ *
+ * @param   uint8_t * destination
+ * @param   int16_t length
+ *
+ * @return  void
+ */
+static inline void SSD1306_Flip (uint8_t *dst, int16_t length)
+{
+  uint64_t word;
+
+  // 8 bytes at once
+  while (length >= 8) {
+    memcpy (&word, dst, 8);
+    word = ~word;
+    memcpy (dst, &word, 8);
+    dst += 8;
+    length -= 8;
+  }
+  // rest
+  while (length-- > 0) {
+    *dst = ~*dst;
+    dst++;
+  }
+}
+
+/**
+ * @desc    SSD1306 Raster operation on one page byte, mode is constant after inlining
+ *
+ * @param   uint8_t byte of cache
+ * @param   uint8_t set pixels of object
+ * @param   uint8_t area of object in byte
+ * @param   uint8_t SSD1306_MODE_*
+ *
+ * @return  uint8_t
+ */
+static inline __attribute__((always_inline)) uint8_t SSD1306_Rop (uint8_t dst, uint8_t src, uint8_t area, uint8_t mode)
+{
+  switch (mode) {
+    // pixels of object cleared
+    case SSD1306_MODE_CLEAR:
+      return dst & ~src;
+    // pixels of object flipped
+    case SSD1306_MODE_XOR:
+      return dst ^ src;
+    // area of object flipped
+    case SSD1306_MODE_INVERT:
+      return dst ^ area;
+    // area of object replaced
+    case SSD1306_MODE_COPY:
+      return (dst & ~area) | src;
+    // pixels of object set
+    default:
+      return dst | src;
+  }
+}
+
+/**
+ * @desc    SSD1306 Blit page-major image into cache, clipped to screen
+ *
+ * @param   SSD1306_Display *
+ * @param   int16_t x
+ * @param   int16_t y
+ * @param   const uint8_t * image, 'width' columns of every page
+ * @param   uint8_t width
+ * @param   uint8_t height
+ * @param   uint8_t SSD1306_MODE_*, SSD1306_MODE_COPY replaces pixels under image
+ *
+ * @return  void
+ */
+static inline __attribute__((always_inline)) void SSD1306_Blit (SSD1306_Display *lcd, int16_t x, int16_t y, const uint8_t *image, uint8_t width, uint8_t height, uint8_t mode)
+{
+  // first page (floor of y / 8) and shift inside page
+  int16_t page = (y >= 0) ? (y >> 3) : -((7 - y) >> 3);
+  uint8_t shift = y - (page << 3);
+  // pages of image, area of last page
+  uint8_t pages = (height + 7) >> 3;
+  uint8_t last = BOTTOM_MASK[(height - 1) & 7];
+  // visible columns
+  int16_t c0 = x < 0 ? -x : 0;
+  int16_t c1 = (x + width > RAM_X_END) ? RAM_X_END - x : width;
+  int16_t length = c1 - c0;
+  // area of page, area of upper and lower part
+  uint8_t area, upper, lower;
+  // source and destination
+  const uint8_t *src;
+  uint8_t *dst;
+  uint8_t *restrict top, *restrict bottom;
+  int16_t i, p;
+
+  // nothing visible
+  if ((length <= 0) || !height) {
+    return;
+  }
+
+  // aligned and whole image visible - straight copy of pages
+  if (!shift && !c0 && (length == width) && (page >= 0) && (page + pages <= lcd->pages)) {
+    dst = lcd->cacheMemLcd + CACHE_INDEX (x, page);
+    for (p = 0; p < pages; p++) {
+      if (SSD1306_Band (lcd, page + p)) {
+        area = (p == pages - 1) ? last : 0xFF;
+        if ((SSD1306_MODE_COPY == mode) && (0xFF == area)) {
+          SSD1306_Copy (dst, image, length);
+        } else {
+          for (i = 0; i < width; i++) {
+            dst[i] = SSD1306_Rop (dst[i], image[i], area, mode);
+          }
+        }
+      }
+      SSD1306_MarkDirty (lcd, page + p, x, x + width - 1);
+      dst += CACHE_STRIDE;
+      image += width;
+    }
+    return;
+  }
+
+  // loop through pages of image
+  for (p = 0; p < pages; p++, page++) {
+    src = image + p * width + c0;
+    area = (p == pages - 1) ? last : 0xFF;
+    // aligned - one page of cache per page of image
+    if (!shift) {
+      // page out of screen or not rendered
+      if ((page < 0) || (page >= lcd->pages)) {
+        continue;
+      }
+      SSD1306_MarkDirty (lcd, page, x + c0, x + c1 - 1);
+      if (!SSD1306_Band (lcd, page)) {
+        continue;
+      }
+      dst = lcd->cacheMemLcd + CACHE_INDEX (x + c0, page);
+      if ((SSD1306_MODE_COPY == mode) && (0xFF == area)) {
+        SSD1306_Copy (dst, src, length);
+      } else {
+        for (i = 0; i < length; i++) {
+          dst[i] = SSD1306_Rop (dst[i], src[i], area, mode);
+        }
+      }
+      continue;
+    }
+    // unaligned - upper part into page, lower part into next page
+    upper = area << shift;
+    lower = area >> (8 - shift);
+    top = ((page >= 0) && (page < lcd->pages) && upper) ? lcd->cacheMemLcd + CACHE_INDEX (x + c0, page) : NULL;
+    bottom = ((page + 1 >= 0) && (page + 1 < lcd->pages) && lower) ? lcd->cacheMemLcd + CACHE_INDEX (x + c0, page + 1) : NULL;
+    // changed columns
+    if (top) {
+      SSD1306_MarkDirty (lcd, page, x + c0, x + c1 - 1);
+    }
+    if (bottom) {
+      SSD1306_MarkDirty (lcd, page + 1, x + c0, x + c1 - 1);
+    }
+    // parts of pages not rendered
+    if (!SSD1306_Band (lcd, page)) {
+      top = NULL;
+    }
+    if (!SSD1306_Band (lcd, page + 1)) {
+      bottom = NULL;
+    }
+    // both parts visible
+    if (top && bottom) {
+      for (i = 0; i < length; i++) {
+        top[i] = SSD1306_Rop (top[i], src[i] << shift, upper, mode);
+        bottom[i] = SSD1306_Rop (bottom[i], src[i] >> (8 - shift), lower, mode);
+      }
+    } else if (top) {
+      for (i = 0; i < length; i++) {
+        top[i] = SSD1306_Rop (top[i], src[i] << shift, upper, mode);
+      }
+    } else if (bottom) {
+      for (i = 0; i < length; i++) {
+        bottom[i] = SSD1306_Rop (bottom[i], src[i] >> (8 - shift), lower, mode);
+      }
+    }
+  }
+}
+
+/**
+ * @desc    SSD1306 Blit in drawing mode - one specialized copy of blit per mode
+ *
+ * @param   SSD1306_Display *
+ * @param   int16_t x
+ * @param   int16_t y
+ * @param   const uint8_t * image
+ * @param   uint8_t width
+ * @param   uint8_t height
+ * @param   uint8_t SSD1306_MODE_*
+ *
+ * @return  void
+ */
+static void SSD1306_BlitMode (SSD1306_Display *lcd, int16_t x, int16_t y, const uint8_t *image, uint8_t width, uint8_t height, uint8_t mode)
+{
+  switch (mode) {
+    case SSD1306_MODE_CLEAR:
+      SSD1306_Blit (lcd, x, y, image, width, height, SSD1306_MODE_CLEAR);
+      break;
+    case SSD1306_MODE_XOR:
+      SSD1306_Blit (lcd, x, y, image, width, height, SSD1306_MODE_XOR);
+      break;
+    case SSD1306_MODE_INVERT:
+      SSD1306_Blit (lcd, x, y, image, width, height, SSD1306_MODE_INVERT);
+      break;
+    case SSD1306_MODE_COPY:
+      SSD1306_Blit (lcd, x, y, image, width, height, SSD1306_MODE_COPY);
+      break;
+    default:
+      SSD1306_Blit (lcd, x, y, image, width, height, SSD1306_MODE_SET);
+      break;
+  }
+}
 
 /**
  * @desc    SSD1306 Init
  *
+ * @param   SSD1306_Display *
+ * @param   SSD1306_Transport * transport
  * @param   uint8_t address
+ * @param   uint8_t height 64 / 32
  *
  * @return  uint8_t
  */
-uint8_t SSD1306_Init (uint8_t address)
+uint8_t SSD1306_Init (SSD1306_Display *lcd, SSD1306_Transport *transport, uint8_t address, uint8_t height)
 { 
   // variables
   const uint8_t *commands = INIT_SSD1306;
@@ -182,26 +568,61 @@ uint8_t SSD1306_Init (uint8_t address)
   uint8_t no_of_arguments;
   // command
   uint8_t command;
+  // command list sent in one transaction
+  uint8_t stream[sizeof(INIT_SSD1306)];
+  // length of command list
+  uint16_t length = 0;
   // init status
   uint8_t status = INIT_STATUS;
 
-#if USE_I2C_DEVICE 
-  fd = open("/dev/i2c-1", O_RDWR);
-  if (fd == -1)
-  {
-    perror("could not open /dev/i2c-1");
-    return -1;
+  // only 128x64 and 128x32 versions
+  if ((height != 64) && (height != 32)) {
+    // error
+    return SSD1306_ERROR;
   }
+
+  // transport, address and geometry
+  lcd->transport = transport;
+  lcd->address = address;
+  lcd->pages = height >> 3;
+  lcd->counter = 0;
+  lcd->wireBytes = 0;
+  lcd->batchCount = 0;
+  lcd->batchLength = 0;
+  lcd->batchDepth = 0;
+  lcd->batchSplit = 0;
+  lcd->batchFailed = 0;
+  memset (lcd->batchStart, 0xFF, RAM_Y_END);
+  memset (lcd->batchEnd, 0x00, RAM_Y_END);
+  lcd->owned = 0;
+  // empty frame
+  SSD1306_ClearCache (lcd->cacheMemLcd);
+#ifdef SSD1306_PAGE_BUFFER
+  // empty display list, calls recorded
+  lcd->listCount = 0;
+  lcd->listTextLength = 0;
+  lcd->band = SSD1306_BAND_IDLE;
 #endif
+  lcd->mode = SSD1306_MODE_SET;
+  lcd->scrollActive = 0;
+  lcd->startLine = 0;
+  // state unknown until init sequence is sent
+  lcd->stateValid = 0;
+  lcd->pointer.valid = 0;
+  // default font, double height
+  lcd->glyphs = SSD1306_GetGlyphs (&SSD1306_FONT_DEFAULT, 1, 2);
+  if (!lcd->glyphs) {
+    // error
+    return SSD1306_ERROR;
+  }
 
-#if USE_I2CMINI
-  i2c_connect(&i2c, "/dev/ttyUSB0");
-  if (!i2c.connected)
-  {
-    perror("could not open /dev/ttyUSB0");
-    return -1;
+  // open transport, first display on transport opens device
+  status = SSD1306_TransportOpen (transport);
+  // request succesfull
+  if (SSD1306_SUCCESS != status) {
+    // error
+    return status;
   }
-#endif
 
   // loop through commands
   while (no_of_commands) {
@@ -209,32 +630,53 @@ uint8_t SSD1306_Init (uint8_t address)
     // number of arguments
     no_of_arguments = pgm_read_byte (commands++);
     // command
-    command = pgm_read_byte (commands++);
+    command = stream[length++] = pgm_read_byte (commands++);
 
-    // send command
-    // -------------------------------------------------------------------------------------
-    status = SSD1306_Send_Command (command);
-    // request - start TWI
-    if (SSD1306_SUCCESS != status) {
-      // error
-      return status;
+    // arguments
+    while (no_of_arguments--) {
+      stream[length++] = pgm_read_byte (commands++);
     }
 
-    // send arguments
-  // -------------------------------------------------------------------------------------
-    while (no_of_arguments--) {
-      // send command
-      status = SSD1306_Send_Command (pgm_read_byte(commands++));
-      // request - start TWI
-      if (SSD1306_SUCCESS != status) {
-        // error
-        return status;
-      }
+    // last argument depends on height
+    if (command == SSD1306_SET_MUX_RATIO) {
+      // 64MUX / 32MUX
+      stream[length-1] = height - 1;
+    } else if (command == SSD1306_SET_PAGE_ADDR) {
+      // last page
+      stream[length-1] = lcd->pages - 1;
+    } else if (command == SSD1306_COM_PIN_CONF) {
+      // alternative / sequential COM pin configuration
+      stream[length-1] = height == 64 ? 0x12 : 0x02;
     }
     // decrement
     no_of_commands--;
   }
 
+  // send command list
+  // -------------------------------------------------------------------------------------
+  status = SSD1306_Send_Commands (lcd, stream, length);
+  // request succesfull
+  if (SSD1306_SUCCESS != status) {
+    // error
+    return status;
+  }
+
+  // state set by init sequence
+  lcd->displayOn = 1;
+  lcd->inverse = 0;
+  lcd->contrast = 0x7F;
+  lcd->startLineSent = 0;
+  lcd->addrMode = SSD1306_ADDR_HORIZONTAL;
+  lcd->addrWindow.c0 = START_COLUMN_ADDR;
+  lcd->addrWindow.c1 = END_COLUMN_ADDR;
+  lcd->addrWindow.p0 = START_PAGE_ADDR;
+  lcd->addrWindow.p1 = lcd->pages - 1;
+  lcd->stateValid = SSD1306_STATE_ALL;
+
+  // content of display RAM is unknown, first update sends whole screen
+  lcd->shadowValid = 0;
+  SSD1306_MarkScreen (lcd, 1);
+
   // success
   return SSD1306_SUCCESS;
 }
@@ -242,286 +684,2217 @@ uint8_t SSD1306_Init (uint8_t address)
 /**
  * @desc    SSD1306 Send Start and SLAW request
  *
- * @param   uint8_t
+ * @param   SSD1306_Display *
  *
  * @return  uint8_t
  */
-uint8_t SSD1306_Send_StartAndSLAW (uint8_t address)
+uint8_t SSD1306_Send_StartAndSLAW (SSD1306_Display *lcd)
 {
+  // transaction started by transport
+  (void) lcd;
   // success
   return SSD1306_SUCCESS;
 }
 
 /**
- * @desc    SSD1306 Send command
+ * @desc    SSD1306 State of display unknown after error, registers are sent again
  *
- * @param   uint8_t command
+ * @param   SSD1306_Display *
  *
- * @return  uint8_t
+ * @return  void
  */
-uint8_t SSD1306_Send_Command (uint8_t command)
+static inline void SSD1306_Stale (SSD1306_Display *lcd)
 {
-#if USE_I2C_DEVICE
-  uint8_t cmd[] = {
-    SSD1306_COMMAND, command };
-
-  struct i2c_msg message = { SSD1306_ADDR, 0, sizeof(cmd), cmd };
-  struct i2c_rdwr_ioctl_data ioctl_data = { &message, 1 };
-  int result = ioctl(fd, I2C_RDWR, &ioctl_data);
-  if (result != 1)
-  {
-    perror("failed to set target");
-    return -1;
-  }
-#endif
-
-#if USE_I2CMINI
-  uint8_t dev = SSD1306_ADDR;
-  uint8_t cmd[] = {
-    SSD1306_COMMAND, command };
-  i2c_start(&i2c, dev, 0);
-  i2c_write(&i2c, cmd, sizeof(cmd));
-  i2c_stop(&i2c);
-#endif 
-
-  // success
-  return SSD1306_SUCCESS;
+  // mirror of registers and RAM pointer
+  lcd->stateValid = 0;
+  lcd->pointer.valid = 0;
 }
 
 /**
- * @desc    SSD1306 Normal colors
+ * @desc    SSD1306 Display owned by flush thread of asynchronous update, other threads
+ *          do not change controller or update state of display
  *
- * @param   uint8_t address
+ * @param   SSD1306_Display *
  *
  * @return  uint8_t
  */
-uint8_t SSD1306_NormalScreen (uint8_t address)
+static inline uint8_t SSD1306_Foreign (SSD1306_Display *lcd)
 {
-  // send command
-  // -------------------------------------------------------------------------------------   
-  uint8_t status = SSD1306_Send_Command (SSD1306_DIS_NORMAL);
-  // request succesfull
-  if (SSD1306_SUCCESS != status) {
-    // error
-    return status;
-  }
-
-  // success
-  return SSD1306_SUCCESS;
+  // flush thread running, caller is other thread
+  return lcd->owned && !pthread_equal (pthread_self (), lcd->owner);
 }
 
 /**
- * @desc    SSD1306 Inverse colors
+ * @desc    SSD1306 Display is in addressing mode
  *
- * @param   uint8_t address
+ * @param   SSD1306_Display *
+ * @param   uint8_t SSD1306_ADDR_*
  *
  * @return  uint8_t
  */
-uint8_t SSD1306_InverseScreen (uint8_t address)
+static inline uint8_t SSD1306_InMode (SSD1306_Display *lcd, uint8_t mode)
 {
-  // send command
-  // -------------------------------------------------------------------------------------   
-  uint8_t status = SSD1306_Send_Command (SSD1306_DIS_INVERSE);
-  // request succesfull
-  if (SSD1306_SUCCESS != status) {
-    // error
-    return status;
-  }
-
-  // success
-  return SSD1306_SUCCESS;
+  // known mode
+  return (lcd->stateValid & SSD1306_STATE_ADDR_MODE) && (mode == lcd->addrMode);
 }
 
 /**
- * @desc    SSD1306 Update screen
+ * @desc    SSD1306 Display is in window of horizontal addressing mode, RAM pointer on its start
  *
- * @param   uint8_t address
+ * @param   SSD1306_Display *
+ * @param   uint8_t start column
+ * @param   uint8_t end column
+ * @param   uint8_t start page
+ * @param   uint8_t end page
  *
  * @return  uint8_t
  */
-uint8_t SSD1306_UpdateScreen (uint8_t address)
+static inline uint8_t SSD1306_Window_Open (SSD1306_Display *lcd, uint8_t c0, uint8_t c1, uint8_t p0, uint8_t p1)
 {
-#if USE_I2C_DEVICE
-  // init status
-  uint8_t status = INIT_STATUS;
-
-  uint8_t cmd[CACHE_SIZE_MEM+1] = {SSD1306_DATA_STREAM};
-  memcpy(cmd+1, cacheMemLcd, CACHE_SIZE_MEM);
-
-  struct i2c_msg message = { SSD1306_ADDR, 0, sizeof(cmd), cmd };
-  struct i2c_rdwr_ioctl_data ioctl_data = { &message, 1 };
-  int result = ioctl(fd, I2C_RDWR, &ioctl_data);
-  if (result != 1)
-  {
-    perror("failed to set bitmap");
-    return -1;
-  }
-#endif
-
-#if USE_I2CMINI
-  uint8_t dev = SSD1306_ADDR;
-  uint8_t cmd[] = {SSD1306_DATA_STREAM};
-  i2c_start(&i2c, dev, 0);
-  i2c_write(&i2c, cmd, sizeof(cmd));
-  i2c_write(&i2c, cacheMemLcd, CACHE_SIZE_MEM);
-  i2c_stop(&i2c);
-#endif
-  // success
-  return SSD1306_SUCCESS;
+  // known window
+  return (lcd->stateValid & SSD1306_STATE_WINDOW) &&
+         (c0 == lcd->addrWindow.c0) && (c1 == lcd->addrWindow.c1) &&
+         (p0 == lcd->addrWindow.p0) && (p1 == lcd->addrWindow.p1);
 }
 
 /**
- * @desc    SSD1306 Clear screen
+ * @desc    SSD1306 Send batch of messages
  *
- * @param   void
+ * @param   SSD1306_Display *
  *
- * @return  void
+ * @return  uint8_t
  */
-void SSD1306_ClearScreen (void)
+static uint8_t SSD1306_Batch_Flush (SSD1306_Display *lcd)
 {
-  // null cache memory lcd
-  memset (cacheMemLcd, 0x00, CACHE_SIZE_MEM);
+  // status
+  uint8_t status = SSD1306_SUCCESS;
+
+  // send messages
+  if (lcd->batchCount) {
+    pthread_mutex_lock (&lcd->transport->lock);
+    status = lcd->transport->ops->write_messages (lcd->transport, lcd->address, lcd->batchMessages, lcd->batchCount);
+    pthread_mutex_unlock (&lcd->transport->lock);
+  }
+  // empty batch
+  lcd->batchCount = 0;
+  lcd->batchLength = 0;
+
+  // status
+  return status;
 }
 
 /**
- * @desc    SSD1306 Set position
+ * @desc    SSD1306 Last message of batch is one command at end of batch buffer
  *
- * @param   uint8_t column -> 0 ... 127 
- * @param   uint8_t page -> 0 ... 7 or 3 
+ * @param   SSD1306_Display *
  *
- * @return  void
+ * @return  uint8_t
  */
-void SSD1306_SetPosition (uint8_t x, uint8_t y) 
+static inline uint8_t SSD1306_Batch_Single (SSD1306_Display *lcd)
 {
-  // calculate counter
-  _counter = x + (y << 7);
+  // last message of batch
+  const SSD1306_Message *last;
+
+  // empty batch
+  if (!lcd->batchCount) {
+    return 0;
+  }
+
+  // command stream of one command
+  last = lcd->batchMessages + lcd->batchCount - 1;
+  return (2 == last->length) &&
+         (SSD1306_COMMAND_STREAM == last->buffer[0]) &&
+         (last->buffer + 2 == lcd->batchBuffer + lcd->batchLength);
 }
 
 /**
- * @desc    SSD1306 Update text poisition - this ensure that character will not be divided at the end of row, 
- *          the whole character will be depicted on the new row
+ * @desc    SSD1306 Reserve message of batch, bytes are filled by caller,
+ *          data stream joins single command in front of it within max transfer
  *
- * @param   void
+ * @param   SSD1306_Display *
+ * @param   uint8_t control byte
+ * @param   uint16_t length
+ * @param   uint8_t ** bytes
  *
  * @return  uint8_t
  */
-uint8_t SSD1306_UpdatePosition (void) 
+static uint8_t SSD1306_Batch_Reserve (SSD1306_Display *lcd, uint8_t control, uint16_t length, uint8_t **bytes)
 {
-  // y / 8
-  uint8_t y = _counter >> 7;
-  // y % 8
-  uint8_t x = _counter - (y << 7);
-  // x + character length + 1
-  uint8_t x_new = x + CHARS_COLS_LENGTH + 1;
+  // status
+  uint8_t status;
+  // message
+  uint8_t *message;
 
-  // check position
-  if (x_new > END_COLUMN_ADDR) {
-    // if more than allowable number of pages
-    if (y > END_PAGE_ADDR) {
-      // return out of range
+  // one command in front of data - continuation control byte (2 bytes) is cheaper
+  // than own message (control and address byte), more commands are not
+  if ((SSD1306_DATA_STREAM == control) && SSD1306_Batch_Single (lcd) &&
+      (lcd->batchLength + length + 1 <= BATCH_SIZE) &&
+      (lcd->batchMessages[lcd->batchCount - 1].length + length + 1 <= lcd->transport->max_transfer)) {
+    // command, data stream follows in same transaction
+    message = lcd->batchBuffer + lcd->batchLength;
+    lcd->batchBuffer[lcd->batchLength - 2] = SSD1306_COMMAND;
+    message[0] = control;
+    *bytes = message + 1;
+    lcd->batchMessages[lcd->batchCount - 1].length += length + 1;
+    lcd->batchLength += length + 1;
+    lcd->wireBytes += length + 1;
+    // success
+    return SSD1306_SUCCESS;
+  }
+
+  // batch full, block of caller sent whole by its end
+  if ((lcd->batchCount == BATCH_MESSAGES) || (lcd->batchLength + length + 1 > BATCH_SIZE)) {
+    if (lcd->batchDepth && !lcd->batchSplit) {
+      // error
       return SSD1306_ERROR;
-    // if x reach the end but page in range
-    } else if (y < (END_PAGE_ADDR-1)) {
-      // update
-      _counter = ((++y) << 7);
+    }
+    status = SSD1306_Batch_Flush (lcd);
+    // request succesfull
+    if (SSD1306_SUCCESS != status) {
+      // error
+      return status;
     }
   }
- 
+
+  // control byte, bytes follow
+  message = lcd->batchBuffer + lcd->batchLength;
+  message[0] = control;
+  *bytes = message + 1;
+  lcd->batchMessages[lcd->batchCount].buffer = message;
+  lcd->batchMessages[lcd->batchCount].length = length + 1;
+  lcd->batchCount++;
+  lcd->batchLength += length + 1;
+
+  // control byte + bytes
+  lcd->wireBytes += length + 1;
+
   // success
   return SSD1306_SUCCESS;
 }
 
 /**
- * @desc    SSD1306 Draw character
+ * @desc    SSD1306 Append message to batch
  *
- * @param   char character
+ * @param   SSD1306_Display *
+ * @param   uint8_t control byte
+ * @param   const uint8_t * bytes
+ * @param   uint16_t length
  *
  * @return  uint8_t
  */
-uint8_t SSD1306_DrawChar (char character)
+static uint8_t SSD1306_Batch_Add (SSD1306_Display *lcd, uint8_t control, const uint8_t *bytes, uint16_t length)
 {
-  // variables
-  int i=0;
-  const uint8_t map[] = {0x00, // 0000 0000 
-                         0x03, // 0000 0011
-                         0x0c, // 0000 1100
-                         0x0f, // 0000 1111
-                         0x30, // 0011 0000
-                         0x33, // 0011 0011
-                         0x3c, // 0011 1100
-                         0x3f, // 0011 1111
-                         0xc0, // 1100 0000 
-                         0xc3, // 1100 0011
-                         0xcc, // 1100 1100
-                         0xcf, // 1100 1111
-                         0xf0, // 1111 0000
-                         0xf3, // 1111 0011
-                         0xfc, // 1111 1100
-                         0xff, // 1111 1111
-  };
-
-  // update text position
-  // this ensure that character will not be divided at the end of row, the whole character will be depicted on the new row
-  if (SSD1306_UpdatePosition () == SSD1306_ERROR) {
-    // error
-    return SSD1306_ERROR;
-  }
+  // bytes of message
+  uint8_t *message;
+  // status
+  uint8_t status = SSD1306_Batch_Reserve (lcd, control, length, &message);
 
-  // loop through 5 bits
-  while (i < CHARS_COLS_LENGTH) {
-    // read byte 
-    uint8_t data = pgm_read_byte(&FONTS[character-32][i++]);
-#if 1
-    uint8_t upper = map[data & 0x0f];
-    uint8_t lower = map[data >> 4];
-    cacheMemLcd[_counter] = upper;
-    cacheMemLcd[_counter+END_COLUMN_ADDR+1] = lower;
-#else
-    cacheMemLcd[_counter] = data;
-#endif
-    _counter++;
+  // copy bytes
+  if (SSD1306_SUCCESS == status) {
+    memcpy (message, bytes, length);
   }
 
-  // update position
-  _counter++;
-
-  // success
-  return SSD1306_SUCCESS;
+  // status
+  return status;
 }
 
 /**
- * @desc    SSD1306 Draw String
+ * @desc    SSD1306 Append message with control byte in front to batch without copy,
+ *          message has to stay unchanged until batch is flushed
  *
+ * @param   SSD1306_Display *
+ * @param   const uint8_t * control byte and bytes
+ * @param   uint16_t length including control byte
+ *
+ * @return  uint8_t
+ */
+static uint8_t SSD1306_Batch_Refer (SSD1306_Display *lcd, const uint8_t *message, uint16_t length)
+{
+  // status
+  uint8_t status;
+
+  // no more messages, block of caller sent whole by its end
+  if (lcd->batchCount == BATCH_MESSAGES) {
+    if (lcd->batchDepth && !lcd->batchSplit) {
+      // error
+      return SSD1306_ERROR;
+    }
+    status = SSD1306_Batch_Flush (lcd);
+    // request succesfull
+    if (SSD1306_SUCCESS != status) {
+      // error
+      return status;
+    }
+  }
+
+  // message in frame
+  lcd->batchMessages[lcd->batchCount].buffer = message;
+  lcd->batchMessages[lcd->batchCount].length = length;
+  lcd->batchCount++;
+
+  // control byte + bytes
+  lcd->wireBytes += length;
+
+  // success
+  return SSD1306_SUCCESS;
+}
+
+/**
+ * @desc    SSD1306 Append commands to batch, command stream at end of batch is extended
+ *          within max transfer
+ *
+ * @param   SSD1306_Display *
+ * @param   const uint8_t * commands
+ * @param   uint16_t length
+ *
+ * @return  uint8_t
+ */
+static uint8_t SSD1306_Batch_Commands (SSD1306_Display *lcd, const uint8_t *commands, uint16_t length)
+{
+  // last message of batch
+  SSD1306_Message *last = lcd->batchCount ? lcd->batchMessages + lcd->batchCount - 1 : NULL;
+
+  // command stream at end of batch buffer and room for commands
+  if (last &&
+      (last->buffer + last->length == lcd->batchBuffer + lcd->batchLength) &&
+      (SSD1306_COMMAND_STREAM == last->buffer[0]) &&
+      (lcd->batchLength + length <= BATCH_SIZE) &&
+      (last->length + length <= lcd->transport->max_transfer)) {
+    // one more transaction saved
+    memcpy (lcd->batchBuffer + lcd->batchLength, commands, length);
+    last->length += length;
+    lcd->batchLength += length;
+    lcd->wireBytes += length;
+    // success
+    return SSD1306_SUCCESS;
+  }
+
+  // new command stream
+  return SSD1306_Batch_Add (lcd, SSD1306_COMMAND_STREAM, commands, length);
+}
+
+/**
+ * @desc    SSD1306 Range of page queued in open block by update
+ *
+ * @param   SSD1306_Display *
+ * @param   uint8_t page
+ * @param   uint8_t start column
+ * @param   uint8_t end column
+ *
+ * @return  void
+ */
+static inline void SSD1306_Batch_Queue (SSD1306_Display *lcd, uint8_t page, uint8_t start, uint8_t end)
+{
+  // extend range
+  if (start < lcd->batchStart[page]) {
+    lcd->batchStart[page] = start;
+  }
+  if (end > lcd->batchEnd[page]) {
+    lcd->batchEnd[page] = end;
+  }
+}
+
+/**
+ * @desc    SSD1306 Ranges of updates queued in open block - sent, or marked dirty again
+ *          when block is not sent
+ *
+ * @param   SSD1306_Display *
+ * @param   uint8_t block sent
+ *
+ * @return  void
+ */
+static void SSD1306_Batch_Settle (SSD1306_Display *lcd, uint8_t sent)
+{
+  uint8_t page;
+
+  // ranges sent again by next update
+  for (page = START_PAGE_ADDR; (page < RAM_Y_END) && !sent; page++) {
+    if (lcd->batchStart[page] <= lcd->batchEnd[page]) {
+      SSD1306_MarkDirty (lcd, page, lcd->batchStart[page], lcd->batchEnd[page]);
+    }
+  }
+  // nothing queued
+  memset (lcd->batchStart, 0xFF, RAM_Y_END);
+  memset (lcd->batchEnd, 0x00, RAM_Y_END);
+}
+
+/**
+ * @desc    SSD1306 Begin transaction - commands, windows and data of following calls
+ *          are queued and sent by SSD1306_End in fewest messages by one call of
+ *          transport, calls return SSD1306_SUCCESS when queued, block not fitting
+ *          into batch fails
+ *
+ * @param   SSD1306_Display *
+ *
+ * @return  void
+ */
+void SSD1306_Begin (SSD1306_Display *lcd)
+{
+  // batch owned by flush thread
+  if (SSD1306_Foreign (lcd)) {
+    return;
+  }
+  // block of caller sent by one call of transport
+  if (!lcd->batchDepth) {
+    lcd->batchSplit = 0;
+  }
+  // nested blocks are sent by outermost end
+  lcd->batchDepth++;
+}
+
+/**
+ * @desc    SSD1306 Begin transaction of library call - sent in parts when batch is full,
+ *          unless opened inside block of caller
+ *
+ * @param   SSD1306_Display *
+ *
+ * @return  void
+ */
+static void SSD1306_Batch_Begin (SSD1306_Display *lcd)
+{
+  // outermost block
+  if (!lcd->batchDepth) {
+    lcd->batchSplit = 1;
+  }
+  // nested blocks are sent by outermost end
+  lcd->batchDepth++;
+}
+
+/**
+ * @desc    SSD1306 End transaction - send queued commands, windows and data
+ *
+ * @param   SSD1306_Display *
+ *
+ * @return  uint8_t
+ */
+uint8_t SSD1306_End (SSD1306_Display *lcd)
+{
+  // status
+  uint8_t status;
+
+  // batch owned by flush thread
+  if (SSD1306_Foreign (lcd)) {
+    // error
+    return SSD1306_ERROR;
+  }
+  // inner block, fails if call of block was dropped
+  if (!lcd->batchDepth || --lcd->batchDepth) {
+    // status
+    return lcd->batchFailed ? SSD1306_ERROR : SSD1306_SUCCESS;
+  }
+
+  // call of block dropped, rest of block not sent
+  if (lcd->batchFailed) {
+    lcd->batchFailed = 0;
+    lcd->batchCount = 0;
+    lcd->batchLength = 0;
+    SSD1306_Batch_Settle (lcd, 0);
+    // error
+    return SSD1306_ERROR;
+  }
+
+  // send queue
+  status = SSD1306_Batch_Flush (lcd);
+  // request succesfull
+  if (SSD1306_SUCCESS != status) {
+    // content and state of display unknown, ranges of queued updates sent again
+    lcd->shadowValid = 0;
+    SSD1306_Batch_Settle (lcd, 0);
+    SSD1306_Stale (lcd);
+    // error
+    return status;
+  }
+
+  // queued updates on display
+  SSD1306_Batch_Settle (lcd, 1);
+
+  // success
+  return SSD1306_SUCCESS;
+}
+
+/**
+ * @desc    SSD1306 Drop queued messages after error, transaction closed
+ *
+ * @param   SSD1306_Display *
+ *
+ * @return  void
+ */
+static void SSD1306_Batch_Drop (SSD1306_Display *lcd)
+{
+  // empty batch
+  lcd->batchCount = 0;
+  lcd->batchLength = 0;
+  // block of call ends, ranges of queued updates sent again
+  if (lcd->batchDepth) {
+    lcd->batchDepth--;
+  }
+  // outer blocks fail at their end
+  lcd->batchFailed = lcd->batchDepth ? 1 : 0;
+  SSD1306_Batch_Settle (lcd, 0);
+  // content and state of display unknown
+  lcd->shadowValid = 0;
+  SSD1306_Stale (lcd);
+}
+
+/**
+ * @desc    SSD1306 Send command
+ *
+ * @param   SSD1306_Display *
+ * @param   uint8_t command
+ *
+ * @return  uint8_t
+ */
+uint8_t SSD1306_Send_Command (SSD1306_Display *lcd, uint8_t command)
+{
+  // command list of one command
+  return SSD1306_Send_Commands (lcd, &command, 1);
+}
+
+/**
+ * @desc    SSD1306 Send command list in one transaction, queued inside SSD1306_Begin / End
+ *
+ * @param   SSD1306_Display *
+ * @param   const uint8_t * commands
+ * @param   uint16_t length
+ *
+ * @return  uint8_t
+ */
+uint8_t SSD1306_Send_Commands (SSD1306_Display *lcd, const uint8_t *commands, uint16_t length)
+{
+  // status
+  uint8_t status;
+
+  // state of display owned by flush thread
+  if (SSD1306_Foreign (lcd)) {
+    // error
+    return SSD1306_ERROR;
+  }
+  // transaction open, commands queued
+  if (lcd->batchDepth && (lcd->transport->caps & TRANSPORT_CAP_SCATTER)) {
+    return SSD1306_Batch_Commands (lcd, commands, length);
+  }
+
+  // send commands
+  pthread_mutex_lock (&lcd->transport->lock);
+  status = lcd->transport->ops->write_commands (lcd->transport, lcd->address, commands, length);
+  pthread_mutex_unlock (&lcd->transport->lock);
+  // request succesfull
+  if (SSD1306_SUCCESS != status) {
+    // state of display unknown
+    SSD1306_Stale (lcd);
+    // error
+    return status;
+  }
+
+  // control byte + commands
+  lcd->wireBytes += length + 1;
+
+  // success
+  return SSD1306_SUCCESS;
+}
+
+/**
+ * @desc    SSD1306 Gather part of window content from pages of frame
+ *
+ * @param   uint8_t * destination
+ * @param   const uint8_t * frame
+ * @param   uint8_t start column
+ * @param   uint16_t number of columns
+ * @param   uint8_t start page
+ * @param   uint16_t offset in window content
+ * @param   uint16_t length
+ *
+ * @return  void
+ */
+static void SSD1306_Gather (uint8_t *dst, const uint8_t *frame, uint8_t c0, uint16_t width, uint8_t p0, uint16_t offset, uint16_t length)
+{
+  // page and column of first byte
+  uint8_t page = p0 + offset / width;
+  uint16_t column = offset % width;
+  uint16_t part;
+
+  // rest of page by page
+  while (length) {
+    part = (width - column) < length ? (width - column) : length;
+    memcpy (dst, frame + CACHE_INDEX (c0 + column, page), part);
+    dst += part;
+    length -= part;
+    column = 0;
+    page++;
+  }
+}
+
+/**
+ * @desc    SSD1306 Position commands of page addressing mode - only parts of RAM pointer
+ *          differing from pointer of display are set, pointer moves behind segment
+ *
+ * @param   SSD1306_Pointer * pointer of display
+ * @param   uint8_t start column
+ * @param   uint8_t end column
+ * @param   uint8_t page
+ * @param   uint8_t * commands, 3 bytes
+ *
+ * @return  uint8_t number of commands
+ */
+static uint8_t SSD1306_Position (SSD1306_Pointer *pointer, uint8_t c0, uint8_t c1, uint8_t page, uint8_t *commands)
+{
+  // number of commands
+  uint8_t length = 0;
+
+  // page
+  if (!pointer->valid || (pointer->page != page)) {
+    commands[length++] = SSD1306_SET_PAGE_START | page;
+  }
+  // lower nibble of column
+  if (!pointer->valid || ((pointer->column ^ c0) & 0x0F)) {
+    commands[length++] = SSD1306_SET_LOW_COLUMN | (c0 & 0x0F);
+  }
+  // upper nibble of column
+  if (!pointer->valid || ((pointer->column ^ c0) & 0xF0)) {
+    commands[length++] = SSD1306_SET_HIGH_COLUMN | (c0 >> 4);
+  }
+
+  // pointer behind segment, wrap at end of page is not relied on
+  pointer->column = c1 + 1;
+  pointer->page = page;
+  pointer->valid = c1 < END_COLUMN_ADDR;
+
+  // number of commands
+  return length;
+}
+
+/**
+ * @desc    SSD1306 Send segment of page in page addressing mode - position and content
+ *          of frame, page from first column is sent from frame with its control byte
+ *          unless content is copied
+ *
+ * @param   SSD1306_Display *
+ * @param   const uint8_t * frame
+ * @param   uint8_t start column
+ * @param   uint8_t end column
+ * @param   uint8_t page
+ * @param   uint8_t copy - frame may change before batch is sent
+ *
+ * @return  uint8_t
+ */
+static uint8_t SSD1306_Send_Segment (SSD1306_Display *lcd, const uint8_t *frame, uint8_t c0, uint8_t c1, uint8_t page, uint8_t copy)
+{
+  // position commands
+  uint8_t commands[3];
+  uint8_t count = SSD1306_Position (&lcd->pointer, c0, c1, page, commands);
+  // content of segment, control byte slot in front of page
+  const uint8_t *content = frame + CACHE_INDEX (c0, page);
+  // length of content
+  uint16_t length = c1 - c0 + 1;
+  // max data bytes of one message
+  uint16_t chunk = lcd->transport->max_transfer - 1;
+  // sent data bytes
+  uint16_t sent = 0;
+  // length of message
+  uint16_t part;
+  // data bytes
+  uint8_t *buffer;
+  // status
+  uint8_t status = SSD1306_SUCCESS;
+
+  // transport capable of scatter-gather
+  if (lcd->transport->caps & TRANSPORT_CAP_SCATTER) {
+    // position, joins commands queued in front of it
+    if (count) {
+      status = SSD1306_Batch_Commands (lcd, commands, count);
+    }
+    // page from first column sent from frame, unless data joins single command
+    if ((SSD1306_SUCCESS == status) && !copy && (START_COLUMN_ADDR == c0) && (length <= chunk) &&
+        (SSD1306_DATA_STREAM == content[-1]) && !SSD1306_Batch_Single (lcd)) {
+      // status
+      return SSD1306_Batch_Refer (lcd, content - 1, length + 1);
+    }
+    // content copied into batch
+    while ((SSD1306_SUCCESS == status) && (sent < length)) {
+      part = (length - sent) < chunk ? (length - sent) : chunk;
+      status = SSD1306_Batch_Reserve (lcd, SSD1306_DATA_STREAM, part, &buffer);
+      if (SSD1306_SUCCESS == status) {
+        memcpy (buffer, content + sent, part);
+      }
+      sent += part;
+    }
+    // status
+    return status;
+  }
+
+  // first message
+  sent = length < chunk ? length : chunk;
+
+  // position and content
+  pthread_mutex_lock (&lcd->transport->lock);
+  if (count) {
+    status = lcd->transport->ops->write_command_and_data (lcd->transport, lcd->address, commands, count, content, sent);
+  } else {
+    status = lcd->transport->ops->write_data (lcd->transport, lcd->address, content, sent);
+  }
+  pthread_mutex_unlock (&lcd->transport->lock);
+  lcd->wireBytes += (count ? count + 1 : 0) + sent + 1;
+
+  // rest of content, display continues on page
+  while ((SSD1306_SUCCESS == status) && (sent < length)) {
+    // length of message
+    part = (length - sent) < chunk ? (length - sent) : chunk;
+    // send message
+    pthread_mutex_lock (&lcd->transport->lock);
+    status = lcd->transport->ops->write_data (lcd->transport, lcd->address, content + sent, part);
+    pthread_mutex_unlock (&lcd->transport->lock);
+    lcd->wireBytes += part + 1;
+    sent += part;
+  }
+
+  // status
+  return status;
+}
+
+/**
+ * @desc    SSD1306 Send window - set column and page range and send content of frame,
+ *          window of one page from first column is sent from frame with its control byte
+ *          unless content is copied, in page addressing mode window is sent page by page
+ *
+ * @param   SSD1306_Display *
+ * @param   const uint8_t * frame
+ * @param   uint8_t start column
+ * @param   uint8_t end column
+ * @param   uint8_t start page
+ * @param   uint8_t end page
+ * @param   uint8_t copy - frame may change before batch is sent
+ *
+ * @return  uint8_t
+ */
+static uint8_t SSD1306_Send_Window (SSD1306_Display *lcd, const uint8_t *frame, uint8_t c0, uint8_t c1, uint8_t p0, uint8_t p1, uint8_t copy)
+{
+  // window content
+  uint8_t *buffer = lcd->window;
+  // window commands
+  const uint8_t window[] = {
+    SSD1306_SET_COLUMN_ADDR, c0, c1,
+    SSD1306_SET_PAGE_ADDR, p0, p1
+  };
+  // control byte slot in front of page
+  const uint8_t *slot = frame + CACHE_INDEX (c0, p0) - 1;
+  // number of columns
+  uint16_t width = c1 - c0 + 1;
+  // length of content
+  uint16_t length = width * (p1 - p0 + 1);
+  // max data bytes of one message
+  uint16_t chunk = lcd->transport->max_transfer - 1;
+  // sent data bytes
+  uint16_t sent = 0;
+  // length of message
+  uint16_t part;
+  // display in window, RAM pointer back on its start
+  uint8_t open = SSD1306_Window_Open (lcd, c0, c1, p0, p1);
+  // status
+  uint8_t status = SSD1306_SUCCESS;
+  uint8_t page;
+
+  // page addressing mode, segment per page
+  if (SSD1306_ADDR_PAGE == lcd->addrMode) {
+    for (page = p0; (page <= p1) && (SSD1306_SUCCESS == status); page++) {
+      status = SSD1306_Send_Segment (lcd, frame, c0, c1, page, copy);
+    }
+    // status
+    return status;
+  }
+
+  // whole window is written, RAM pointer wraps to its start
+  lcd->addrWindow.c0 = c0;
+  lcd->addrWindow.c1 = c1;
+  lcd->addrWindow.p0 = p0;
+  lcd->addrWindow.p1 = p1;
+  lcd->stateValid |= SSD1306_STATE_WINDOW;
+
+  // transport capable of scatter-gather
+  if (lcd->transport->caps & TRANSPORT_CAP_SCATTER) {
+    // window, joins commands queued in front of it
+    if (!open) {
+      status = SSD1306_Batch_Commands (lcd, window, sizeof(window));
+    }
+    // one page from first column, slot and page are one message
+    if ((SSD1306_SUCCESS == status) && !copy && (p0 == p1) && (START_COLUMN_ADDR == c0) && 
+        (length <= chunk) && (SSD1306_DATA_STREAM == *slot)) {
+      // status
+      return SSD1306_Batch_Refer (lcd, slot, length + 1);
+    }
+    // content gathered straight into batch
+    while ((SSD1306_SUCCESS == status) && (sent < length)) {
+      part = (length - sent) < chunk ? (length - sent) : chunk;
+      status = SSD1306_Batch_Reserve (lcd, SSD1306_DATA_STREAM, part, &buffer);
+      if (SSD1306_SUCCESS == status) {
+        SSD1306_Gather (buffer, frame, c0, width, p0, sent, part);
+      }
+      sent += part;
+    }
+    // status
+    return status;
+  }
+
+  // gather content of window
+  SSD1306_Gather (buffer, frame, c0, width, p0, 0, length);
+  // first message
+  sent = length < chunk ? length : chunk;
+
+  // window and content
+  pthread_mutex_lock (&lcd->transport->lock);
+  if (open) {
+    status = lcd->transport->ops->write_data (lcd->transport, lcd->address, buffer, sent);
+  } else {
+    status = lcd->transport->ops->write_command_and_data (lcd->transport, lcd->address, window, sizeof(window), buffer, sent);
+  }
+  pthread_mutex_unlock (&lcd->transport->lock);
+  lcd->wireBytes += (open ? 0 : sizeof(window) + 1) + sent + 1;
+
+  // rest of content, display continues in window
+  while ((SSD1306_SUCCESS == status) && (sent < length)) {
+    // length of message
+    part = (length - sent) < chunk ? (length - sent) : chunk;
+    // send message
+    pthread_mutex_lock (&lcd->transport->lock);
+    status = lcd->transport->ops->write_data (lcd->transport, lcd->address, buffer + sent, part);
+    pthread_mutex_unlock (&lcd->transport->lock);
+    lcd->wireBytes += part + 1;
+    sent += part;
+  }
+
+  // status
+  return status;
+}
+
+/**
+ * @desc    SSD1306 Send register setting, not sent if display has it
+ *
+ * @param   SSD1306_Display *
+ * @param   uint8_t SSD1306_STATE_* of register
+ * @param   uint8_t * mirror of register
+ * @param   uint8_t value
+ * @param   const uint8_t * commands
+ * @param   uint16_t length
+ *
+ * @return  uint8_t
+ */
+static uint8_t SSD1306_Send_State (SSD1306_Display *lcd, uint8_t state, uint8_t *mirror, uint8_t value, const uint8_t *commands, uint16_t length)
+{
+  // status
+  uint8_t status;
+
+  // state of display owned by flush thread
+  if (SSD1306_Foreign (lcd)) {
+    // error
+    return SSD1306_ERROR;
+  }
+  // display has setting
+  if ((lcd->stateValid & state) && (value == *mirror)) {
+    // success
+    return SSD1306_SUCCESS;
+  }
+
+  // send commands
+  status = SSD1306_Send_Commands (lcd, commands, length);
+  // request succesfull
+  if (SSD1306_SUCCESS != status) {
+    // error
+    return status;
+  }
+
+  // setting of display
+  *mirror = value;
+  lcd->stateValid |= state;
+
+  // success
+  return SSD1306_SUCCESS;
+}
+
+/**
+ * @desc    SSD1306 Normal colors, not sent if display has them
+ *
+ * @param   SSD1306_Display *
+ *
+ * @return  uint8_t
+ */
+uint8_t SSD1306_NormalScreen (SSD1306_Display *lcd)
+{
+  // command
+  const uint8_t command = SSD1306_DIS_NORMAL;
+
+  // send command
+  // -------------------------------------------------------------------------------------   
+  return SSD1306_Send_State (lcd, SSD1306_STATE_INVERSE, &lcd->inverse, 0, &command, 1);
+}
+
+/**
+ * @desc    SSD1306 Inverse colors, not sent if display has them
+ *
+ * @param   SSD1306_Display *
+ *
+ * @return  uint8_t
+ */
+uint8_t SSD1306_InverseScreen (SSD1306_Display *lcd)
+{
+  // command
+  const uint8_t command = SSD1306_DIS_INVERSE;
+
+  // send command
+  // -------------------------------------------------------------------------------------   
+  return SSD1306_Send_State (lcd, SSD1306_STATE_INVERSE, &lcd->inverse, 1, &command, 1);
+}
+
+/**
+ * @desc    SSD1306 Display on, not sent if display is on
+ *
+ * @param   SSD1306_Display *
+ *
+ * @return  uint8_t
+ */
+uint8_t SSD1306_DisplayOn (SSD1306_Display *lcd)
+{
+  // command
+  const uint8_t command = SSD1306_DISPLAY_ON;
+
+  // send command
+  // -------------------------------------------------------------------------------------   
+  return SSD1306_Send_State (lcd, SSD1306_STATE_DISPLAY, &lcd->displayOn, 1, &command, 1);
+}
+
+/**
+ * @desc    SSD1306 Display off (sleep), RAM is kept, not sent if display is off
+ *
+ * @param   SSD1306_Display *
+ *
+ * @return  uint8_t
+ */
+uint8_t SSD1306_DisplayOff (SSD1306_Display *lcd)
+{
+  // command
+  const uint8_t command = SSD1306_DISPLAY_OFF;
+
+  // send command
+  // -------------------------------------------------------------------------------------   
+  return SSD1306_Send_State (lcd, SSD1306_STATE_DISPLAY, &lcd->displayOn, 0, &command, 1);
+}
+
+/**
+ * @desc    SSD1306 Resync - mirrored state (on / off, colors, contrast, addressing
+ *          mode, start line) is sent again and next update rewrites whole RAM
+ *
+ * @param   SSD1306_Display *
+ *
+ * @return  uint8_t
+ */
+uint8_t SSD1306_Resync (SSD1306_Display *lcd)
+{
+  // state of display
+  const uint8_t commands[] = {
+    lcd->displayOn ? SSD1306_DISPLAY_ON : SSD1306_DISPLAY_OFF,
+    lcd->inverse ? SSD1306_DIS_INVERSE : SSD1306_DIS_NORMAL,
+    SSD1306_SET_CONTRAST, lcd->contrast,
+    SSD1306_MEMORY_ADDR_MODE, lcd->addrMode,
+    SSD1306_SET_START_LINE | lcd->startLineSent
+  };
+  // status
+  uint8_t status;
+
+  // state of display owned by flush thread
+  if (SSD1306_Foreign (lcd)) {
+    // error
+    return SSD1306_ERROR;
+  }
+  // content of display unknown, whole RAM sent by next update
+  lcd->shadowValid = 0;
+  SSD1306_MarkScreen (lcd, 1);
+  SSD1306_Stale (lcd);
+
+  // send commands
+  status = SSD1306_Send_Commands (lcd, commands, sizeof(commands));
+  // request succesfull
+  if (SSD1306_SUCCESS != status) {
+    // error
+    return status;
+  }
+
+  // registers known, RAM pointer set by next window
+  lcd->stateValid = SSD1306_STATE_ALL & ~SSD1306_STATE_WINDOW;
+
+  // success
+  return SSD1306_SUCCESS;
+}
+
+/**
+ * @desc    SSD1306 Diff dirty range of page against last sent frame, changed bytes are
+ *          grouped into runs, gaps cheaper to send than reopening window are joined
+ *
+ * @param   SSD1306_Display *
+ * @param   const uint8_t * frame
+ * @param   const uint8_t * first dirty columns of pages
+ * @param   const uint8_t * last dirty columns of pages
+ * @param   uint8_t page
+ * @param   uint8_t * start columns of runs
+ * @param   uint8_t * end columns of runs
+ *
+ * @return  uint8_t number of runs
+ */
+static uint8_t SSD1306_Diff (SSD1306_Display *lcd, const uint8_t *frame, const uint8_t *first, const uint8_t *last, uint8_t page, uint8_t *starts, uint8_t *ends)
+{
+#ifdef SSD1306_PAGE_BUFFER
+  // no shadow in page-buffer mode, dirty range is one run
+  (void) lcd;
+  (void) frame;
+  starts[0] = first[page];
+  ends[0] = last[page];
+  return 1;
+#else
+  // frame and shadow of page
+  const uint8_t *cache = frame + CACHE_INDEX (0, page);
+  const uint8_t *shadow = lcd->shadowMemLcd + CACHE_INDEX (0, page);
+  // number of runs
+  uint8_t runs = 0;
+  uint8_t x = first[page];
+
+  // content of page unknown
+  if (!(lcd->shadowValid & (1 << page))) {
+    starts[0] = first[page];
+    ends[0] = last[page];
+    return 1;
+  }
+
+  // loop through dirty range
+  while (x <= last[page]) {
+    // unchanged byte
+    if (cache[x] == shadow[x]) {
+      x++;
+      continue;
+    }
+    // gap to previous run cheaper than new window
+    if (runs && ((x - ends[runs-1] - 1) <= WINDOW_COST)) {
+      ends[runs-1] = x;
+    } else {
+      starts[runs] = ends[runs] = x;
+      runs++;
+    }
+    x++;
+  }
+
+  // number of runs
+  return runs;
+#endif
+}
+
+/**
+ * @desc    SSD1306 Bytes of runs sent in page addressing mode, position of next run
+ *          follows from previous one
+ *
+ * @param   SSD1306_Display *
+ * @param   const SSD1306_Window * runs of pages
+ * @param   uint8_t number of runs
+ *
+ * @return  uint16_t
+ */
+static uint16_t SSD1306_PageCost (SSD1306_Display *lcd, const SSD1306_Window *segments, uint8_t count)
+{
+  // pointer of display, valid only in page addressing mode
+  SSD1306_Pointer pointer = lcd->pointer;
+  // position commands
+  uint8_t commands[3];
+  uint8_t length, i;
+  // bytes
+  uint16_t cost = 0;
+
+  // loop through runs
+  for (i = 0; i < count; i++) {
+    length = SSD1306_Position (&pointer, segments[i].c0, segments[i].c1, segments[i].p0, commands);
+    // control byte and position, control byte and content
+    cost += (length ? 1 + length : 0) + 1 + (segments[i].c1 - segments[i].c0 + 1);
+    // message of data, single command joins it
+    cost += (length > 1) ? 2 * MESSAGE_COST : MESSAGE_COST;
+  }
+
+  // bytes
+  return cost;
+}
+
+/**
+ * @desc    SSD1306 Set memory addressing mode, sent only if display is in other mode
+ *
+ * @param   SSD1306_Display *
+ * @param   uint8_t SSD1306_ADDR_HORIZONTAL / SSD1306_ADDR_PAGE
+ *
+ * @return  uint8_t
+ */
+static uint8_t SSD1306_Set_AddrMode (SSD1306_Display *lcd, uint8_t mode)
+{
+  // mode command with argument
+  const uint8_t commands[] = { SSD1306_MEMORY_ADDR_MODE, mode };
+  // status
+  uint8_t status;
+
+  // display in mode
+  if (SSD1306_InMode (lcd, mode)) {
+    // success
+    return SSD1306_SUCCESS;
+  }
+
+  // send commands, joins window of update
+  status = SSD1306_Send_Commands (lcd, commands, sizeof(commands));
+  // request succesfull
+  if (SSD1306_SUCCESS != status) {
+    // error
+    return status;
+  }
+
+  // pointer set by next window
+  lcd->addrMode = mode;
+  lcd->stateValid = (lcd->stateValid | SSD1306_STATE_ADDR_MODE) & ~SSD1306_STATE_WINDOW;
+  lcd->pointer.valid = 0;
+
+  // success
+  return SSD1306_SUCCESS;
+}
+
+/**
+ * @desc    SSD1306 Set contrast, not sent if display has it
+ *
+ * @param   SSD1306_Display *
+ * @param   uint8_t contrast 0x00 ... 0xFF
+ *
+ * @return  uint8_t
+ */
+uint8_t SSD1306_SetContrast (SSD1306_Display *lcd, uint8_t contrast)
+{
+  // contrast command with argument
+  const uint8_t commands[] = { SSD1306_SET_CONTRAST, contrast };
+
+  // send commands
+  // -------------------------------------------------------------------------------------   
+  return SSD1306_Send_State (lcd, SSD1306_STATE_CONTRAST, &lcd->contrast, contrast, commands, sizeof(commands));
+}
+
+/**
+ * @desc    SSD1306 Send frame - sends changed bytes of dirty column ranges of frame,
+ *          dirty ranges are left to caller
+ *
+ * @param   SSD1306_Display *
+ * @param   const uint8_t * frame
+ * @param   const uint8_t * first dirty columns of pages
+ * @param   const uint8_t * last dirty columns of pages
+ * @param   uint8_t copy - frame is transient, content copied into batch
+ *
+ * @return  uint8_t
+ */
+static uint8_t SSD1306_Send_Frame (SSD1306_Display *lcd, const uint8_t *frame, const uint8_t *first, const uint8_t *last, uint8_t copy)
+{
+  // runs of changed bytes
+  uint8_t starts[RAM_X_END], ends[RAM_X_END];
+  uint8_t runs, run;
+  // runs of pages, page addressing mode
+  SSD1306_Window segments[WINDOWS_MAX];
+  uint8_t nsegments = 0;
+  // runs joined over pages, horizontal addressing mode
+  SSD1306_Window windows[WINDOWS_MAX];
+  uint8_t nwindows = 0;
+  // open window
+  SSD1306_Window *window = NULL;
+  // union of columns
+  uint8_t u0, u1;
+  // costs
+  uint16_t joined, separate;
+  uint16_t horizontal, paged;
+  // addressing mode of update
+  uint8_t mode;
+  // status
+  uint8_t status = SSD1306_SUCCESS;
+  uint8_t page, i;
+
+  // nothing sent yet
+  lcd->wireBytes = 0;
+
+  // loop through pages of RAM, hidden pages are dirty only if drawn by SSD1306_MarkRange
+  for (page = START_PAGE_ADDR; page < RAM_Y_END; page++) {
+    // clean page or page scrolled by display
+    if ((first[page] > last[page]) || SSD1306_Scrolled (lcd, page)) {
+      continue;
+    }
+    // changed bytes
+    runs = SSD1306_Diff (lcd, frame, first, last, page, starts, ends);
+    // loop through runs
+    for (run = 0; run < runs; run++) {
+      // run of page
+      segments[nsegments].c0 = starts[run];
+      segments[nsegments].c1 = ends[run];
+      segments[nsegments].p0 = segments[nsegments].p1 = page;
+      nsegments++;
+      // single run adjacent to open window
+      if (window && (runs == 1) && (page == window->p1 + 1)) {
+        // union of column ranges
+        u0 = starts[run] < window->c0 ? starts[run] : window->c0;
+        u1 = ends[run] > window->c1 ? ends[run] : window->c1;
+        // cost of one window over both ranges
+        joined = WINDOW_COST + (u1 - u0 + 1) * (page - window->p0 + 1);
+        // cost of two windows
+        separate = WINDOW_COST + (window->c1 - window->c0 + 1) * (window->p1 - window->p0 + 1) 
+                 + WINDOW_COST + (ends[run] - starts[run] + 1);
+        // extend window
+        if (joined <= separate) {
+          window->c0 = u0;
+          window->c1 = u1;
+          window->p1 = page;
+          continue;
+        }
+      }
+      // open new window
+      window = windows + nwindows++;
+      *window = segments[nsegments - 1];
+    }
+  }
+
+  // bytes of horizontal addressing mode - messages of window commands and content
+  horizontal = SSD1306_InMode (lcd, SSD1306_ADDR_HORIZONTAL) ? 0 : MODE_COST;
+  for (i = 0; i < nwindows; i++) {
+    horizontal += WINDOW_COST + 2 * MESSAGE_COST + (windows[i].c1 - windows[i].c0 + 1) * (windows[i].p1 - windows[i].p0 + 1);
+  }
+  // window of display reopened without commands
+  if (nwindows && SSD1306_Window_Open (lcd, windows[0].c0, windows[0].c1, windows[0].p0, windows[0].p1)) {
+    horizontal -= WINDOW_COST - 1 + MESSAGE_COST;
+  }
+  // bytes of page addressing mode - messages of position commands and content
+  paged = SSD1306_InMode (lcd, SSD1306_ADDR_PAGE) ? 0 : MODE_COST;
+  paged += SSD1306_PageCost (lcd, segments, nsegments);
+  // mode of display kept unless other one is cheaper
+  mode = ((paged < horizontal) || ((paged == horizontal) && SSD1306_InMode (lcd, SSD1306_ADDR_PAGE))) ? 
+         SSD1306_ADDR_PAGE : SSD1306_ADDR_HORIZONTAL;
+
+  // mode, windows and start line in one transaction
+  SSD1306_Batch_Begin (lcd);
+  if (nsegments) {
+    status = SSD1306_Set_AddrMode (lcd, mode);
+  }
+  // page addressing mode, runs of pages
+  if (SSD1306_ADDR_PAGE == mode) {
+    for (i = 0; (i < nsegments) && (SSD1306_SUCCESS == status); i++) {
+      status = SSD1306_Send_Segment (lcd, frame, segments[i].c0, segments[i].c1, segments[i].p0, copy);
+    }
+  // horizontal addressing mode, windows
+  } else {
+    for (i = 0; (i < nwindows) && (SSD1306_SUCCESS == status); i++) {
+      status = SSD1306_Send_Window (lcd, frame, windows[i].c0, windows[i].c1, windows[i].p0, windows[i].p1, copy);
+    }
+  }
+  // request succesfull
+  if (SSD1306_SUCCESS != status) {
+    // drop queued windows
+    SSD1306_Batch_Drop (lcd);
+    // error
+    return status;
+  }
+
+  // start line moved after content of new lines is in RAM
+  if ((lcd->startLine != lcd->startLineSent) || !(lcd->stateValid & SSD1306_STATE_START_LINE)) {
+    status = SSD1306_Send_Command (lcd, SSD1306_SET_START_LINE | lcd->startLine);
+    // request succesfull
+    if (SSD1306_SUCCESS != status) {
+      // drop queued windows
+      SSD1306_Batch_Drop (lcd);
+      // error
+      return status;
+    }
+    lcd->startLineSent = lcd->startLine;
+    lcd->stateValid |= SSD1306_STATE_START_LINE;
+  }
+
+  // send queued windows and start line, by outer SSD1306_End if nested
+  status = SSD1306_End (lcd);
+  // request succesfull
+  if (SSD1306_SUCCESS != status) {
+    // error
+    return status;
+  }
+
+  // remember sent frame, queued ranges marked dirty again if outer block fails
+  for (page = START_PAGE_ADDR; page < RAM_Y_END; page++) {
+    if ((first[page] <= last[page]) && !SSD1306_Scrolled (lcd, page)) {
+#ifndef SSD1306_PAGE_BUFFER
+      memcpy (lcd->shadowMemLcd + CACHE_INDEX (first[page], page), 
+              frame + CACHE_INDEX (first[page], page), 
+              last[page] - first[page] + 1);
+      // whole page known
+      if ((START_COLUMN_ADDR == first[page]) && (END_COLUMN_ADDR == last[page])) {
+        lcd->shadowValid |= 1 << page;
+      }
+#endif
+      if (lcd->batchDepth) {
+        SSD1306_Batch_Queue (lcd, page, first[page], last[page]);
+      }
+    }
+  }
+
+  // success
+  return SSD1306_SUCCESS;
+}
+
+/**
+ * @desc    SSD1306 Update frame - sends changed bytes of dirty column ranges of frame,
+ *          dirty ranges are left to caller
+ *
+ * @param   SSD1306_Display *
+ * @param   const uint8_t * frame
+ * @param   const uint8_t * first dirty columns of pages
+ * @param   const uint8_t * last dirty columns of pages
+ *
+ * @return  uint8_t
+ */
+uint8_t SSD1306_UpdateFrame (SSD1306_Display *lcd, const uint8_t *frame, const uint8_t *first, const uint8_t *last)
+{
+  // display owned by flush thread
+  if (SSD1306_Foreign (lcd)) {
+    // error
+    return SSD1306_ERROR;
+  }
+  // queued by outer block - frame may change before block is sent
+  return SSD1306_Send_Frame (lcd, frame, first, last, lcd->batchDepth ? 1 : 0);
+}
+
+#ifdef SSD1306_PAGE_BUFFER
+/**
+ * @desc    SSD1306 Replay recorded drawing call in its drawing mode
+ *
+ * @param   SSD1306_Display *
+ * @param   const SSD1306_Op *
+ *
+ * @return  uint8_t
+ */
+static uint8_t SSD1306_Replay (SSD1306_Display *lcd, const SSD1306_Op *op)
+{
+  // bitmap of recorded data
+  SSD1306_Bitmap bitmap;
+  // status
+  uint8_t status = SSD1306_SUCCESS;
+
+  // drawing mode of call
+  lcd->mode = op->mode;
+  // drawing function
+  switch (op->type) {
+    case SSD1306_OP_PIXEL:
+      status = SSD1306_DrawPixel (lcd, op->a, op->b);
+      break;
+    case SSD1306_OP_FILL:
+      status = SSD1306_FillRect (lcd, op->a, op->b, op->c, op->d);
+      break;
+    case SSD1306_OP_LINE:
+      status = SSD1306_DrawLine (lcd, op->a, op->b, op->c, op->d);
+      break;
+    case SSD1306_OP_STRING:
+      lcd->counter = op->a;
+      lcd->glyphs = op->data;
+      status = SSD1306_DrawString (lcd, lcd->listText + op->c);
+      break;
+    case SSD1306_OP_TEXT:
+      status = SSD1306_DrawText (lcd, op->a, op->b, op->data, op->d, lcd->listText + op->c);
+      break;
+    case SSD1306_OP_BITMAP:
+      bitmap.width = op->c;
+      bitmap.height = op->d;
+      bitmap.data = op->data;
+      status = SSD1306_DrawBitmap (lcd, op->a, op->b, &bitmap);
+      break;
+    default:
+      status = SSD1306_InsertBitmap (lcd, op->a, op->b, op->data);
+      break;
+  }
+
+  // status
+  return status;
+}
+
+/**
+ * @desc    SSD1306 Record drawing call into display list - call is run without drawing,
+ *          pages it marks dirty are binned, calls drawing nothing are not kept
+ *
+ * @param   SSD1306_Display *
+ * @param   uint8_t SSD1306_OP_*
+ * @param   int16_t 1st argument
+ * @param   int16_t 2nd argument
+ * @param   int16_t 3rd argument
+ * @param   int16_t 4th argument
+ * @param   const void * font, glyphs or bitmap data, kept by pointer
+ * @param   const char * string copied into list, NULL
+ *
+ * @return  uint8_t
+ */
+static uint8_t SSD1306_Record (SSD1306_Display *lcd, uint8_t type, int16_t a, int16_t b, int16_t c, int16_t d, const void *data, const char *str)
+{
+  // next call of list
+  SSD1306_Op *op = lcd->listOps + lcd->listCount;
+  // length of string
+  uint16_t length = str ? strlen (str) + 1 : 0;
+  // status
+  uint8_t status;
+
+  // list or strings full, call not drawn
+  if ((lcd->listCount == SSD1306_LIST_OPS) || (lcd->listTextLength + length > SSD1306_LIST_TEXT)) {
+    // error
+    return SSD1306_ERROR;
+  }
+
+  // call
+  op->type = type;
+  op->mode = lcd->mode;
+  op->a = a;
+  op->b = b;
+  op->c = str ? lcd->listTextLength : c;
+  op->d = d;
+  op->data = data;
+  if (str) {
+    memcpy (lcd->listText + lcd->listTextLength, str, length);
+  }
+
+  // pages marked by call
+  lcd->band = SSD1306_BAND_NONE;
+  lcd->touched = 0;
+  status = SSD1306_Replay (lcd, op);
+  lcd->band = SSD1306_BAND_IDLE;
+  op->pages = lcd->touched;
+
+  // call draws on screen
+  if (op->pages) {
+    lcd->listCount++;
+    lcd->listTextLength += length;
+  }
+
+  // status
+  return status;
+}
+
+/**
+ * @desc    SSD1306 Record characters at text position - string of one call in list,
+ *          joined to recorded string ending at same position in same glyphs and mode
+ *
+ * @param   SSD1306_Display *
+ * @param   const char * string
+ *
+ * @return  uint8_t
+ */
+static uint8_t SSD1306_Record_String (SSD1306_Display *lcd, const char *str)
+{
+  // last call of list, its string ends strings of list
+  SSD1306_Op *last = lcd->listCount ? lcd->listOps + lcd->listCount - 1 : NULL;
+  // length of string
+  uint16_t length = strlen (str);
+  // call of string
+  uint8_t count = lcd->listCount;
+  // status
+  uint8_t status = SSD1306_SUCCESS;
+  uint16_t i;
+
+  // string continued where recorded string ends
+  if (last && (SSD1306_OP_STRING == last->type) && (last->mode == lcd->mode) &&
+      (last->data == lcd->glyphs) && (last->b == (int16_t) lcd->counter)) {
+    // strings full, characters not drawn
+    if (lcd->listTextLength + length > SSD1306_LIST_TEXT) {
+      // error
+      return SSD1306_ERROR;
+    }
+    // characters run without drawing, pages they mark binned
+    lcd->band = SSD1306_BAND_NONE;
+    lcd->touched = 0;
+    for (i = 0; i < length; i++) {
+      if (SSD1306_SUCCESS != SSD1306_DrawChar (lcd, str[i])) {
+        status = SSD1306_ERROR;
+      }
+    }
+    lcd->band = SSD1306_BAND_IDLE;
+    last->pages |= lcd->touched;
+    // appended over terminator of recorded string
+    memcpy (lcd->listText + lcd->listTextLength - 1, str, length + 1);
+    lcd->listTextLength += length;
+    last->b = lcd->counter;
+    // status
+    return status;
+  }
+
+  // new call, text position after string kept for joining
+  status = SSD1306_Record (lcd, SSD1306_OP_STRING, lcd->counter, 0, 0, 0, lcd->glyphs, str);
+  if (lcd->listCount > count) {
+    lcd->listOps[count].b = lcd->counter;
+  }
+
+  // status
+  return status;
+}
+
+/**
+ * @desc    SSD1306 Hash of page content - FNV-1a, unchanged page is not sent again
+ *
+ * @param   const uint8_t * page
+ *
+ * @return  uint32_t
+ */
+static uint32_t SSD1306_PageSum (const uint8_t *page)
+{
+  // offset basis
+  uint32_t sum = 2166136261UL;
+  uint8_t i;
+
+  // loop through columns
+  for (i = 0; i < RAM_X_END; i++) {
+    sum = (sum ^ page[i]) * 16777619UL;
+  }
+
+  // hash
+  return sum;
+}
+
+/**
+ * @desc    SSD1306 Replay display list into page of cache, calls binned to page
+ *
+ * @param   SSD1306_Display *
+ * @param   uint8_t page, SSD1306_BAND_NONE marks columns of all calls without drawing
+ *
+ * @return  void
+ */
+static void SSD1306_Replay_List (SSD1306_Display *lcd, uint8_t band)
+{
+  // state changed by replayed calls
+  unsigned int counter = lcd->counter;
+  const SSD1306_Glyphs *glyphs = lcd->glyphs;
+  uint8_t mode = lcd->mode;
+  uint8_t i;
+
+  // loop through calls
+  lcd->band = band;
+  for (i = 0; i < lcd->listCount; i++) {
+    if ((SSD1306_BAND_NONE == band) || (lcd->listOps[i].pages & (1 << band))) {
+      SSD1306_Replay (lcd, lcd->listOps + i);
+    }
+  }
+  lcd->band = SSD1306_BAND_IDLE;
+
+  // state of caller
+  lcd->counter = counter;
+  lcd->glyphs = glyphs;
+  lcd->mode = mode;
+}
+
+/**
+ * @desc    SSD1306 Render dirty pages - calls of display list touching page are replayed
+ *          into cache of one page, page is sent unless its hash matches page on display
+ *          and cache is reused for next page, pages and start line in one transaction
+ *
+ * @param   SSD1306_Display *
+ *
+ * @return  uint8_t
+ */
+static uint8_t SSD1306_Render (SSD1306_Display *lcd)
+{
+  // dirty ranges of update
+  uint8_t starts[RAM_Y_END], ends[RAM_Y_END];
+  // dirty ranges kept over replay
+  uint8_t kept[RAM_Y_END], keptEnd[RAM_Y_END];
+  // dirty range of rendered page only
+  uint8_t first[RAM_Y_END], last[RAM_Y_END];
+  // start line moved after content of all pages
+  uint8_t line = lcd->startLine;
+  // hash of rendered page
+  uint32_t sum;
+  // bytes of all pages
+  uint16_t wireBytes = 0;
+  // status
+  uint8_t status = SSD1306_SUCCESS;
+  uint8_t page;
+
+  // display owned by flush thread
+  if (SSD1306_Foreign (lcd)) {
+    // error
+    return SSD1306_ERROR;
+  }
+
+  // pages to render
+  memcpy (starts, lcd->dirtyStart, RAM_Y_END);
+  memcpy (ends, lcd->dirtyEnd, RAM_Y_END);
+  memset (first, 0xFF, RAM_Y_END);
+  memset (last, 0x00, RAM_Y_END);
+
+  // pages and start line in one transaction, start line held until pages are queued
+  SSD1306_Batch_Begin (lcd);
+  lcd->startLine = lcd->startLineSent;
+
+  // loop through pages of RAM
+  for (page = START_PAGE_ADDR; (page < RAM_Y_END) && (SSD1306_SUCCESS == status); page++) {
+    // clean page or page scrolled by display
+    if ((starts[page] > ends[page]) || SSD1306_Scrolled (lcd, page)) {
+      continue;
+    }
+    // empty page, calls binned to page drawn into it
+    SSD1306_ClearCache (lcd->cacheMemLcd);
+    // ranges marked by replayed calls are not kept
+    memcpy (kept, lcd->dirtyStart, RAM_Y_END);
+    memcpy (keptEnd, lcd->dirtyEnd, RAM_Y_END);
+    SSD1306_Replay_List (lcd, page);
+    memcpy (lcd->dirtyStart, kept, RAM_Y_END);
+    memcpy (lcd->dirtyEnd, keptEnd, RAM_Y_END);
+    // page on display unchanged
+    sum = SSD1306_PageSum (lcd->cacheMemLcd + CACHE_INDEX (START_COLUMN_ADDR, page));
+    if ((lcd->shadowValid & (1 << page)) && (sum == lcd->pageSum[page])) {
+      lcd->dirtyStart[page] = 0xFF;
+      lcd->dirtyEnd[page] = 0x00;
+      continue;
+    }
+    // page queued in block - page buffer redrawn by next page before block is sent
+    first[page] = starts[page];
+    last[page] = ends[page];
+    status = SSD1306_Send_Frame (lcd, lcd->cacheMemLcd, first, last, 1);
+    wireBytes += lcd->wireBytes;
+    // page queued, marked again and hash forgotten if block is not sent
+    if (SSD1306_SUCCESS == status) {
+      // rest of page matched display, or whole page sent
+      if ((START_COLUMN_ADDR == first[page]) && (END_COLUMN_ADDR == last[page])) {
+        lcd->shadowValid |= 1 << page;
+      }
+      lcd->pageSum[page] = sum;
+      lcd->dirtyStart[page] = 0xFF;
+      lcd->dirtyEnd[page] = 0x00;
+    }
+    first[page] = 0xFF;
+    last[page] = 0x00;
+  }
+
+  // start line after content of pages
+  lcd->startLine = line;
+  if (SSD1306_SUCCESS == status) {
+    status = SSD1306_Send_Frame (lcd, lcd->cacheMemLcd, first, last, 1);
+    wireBytes += lcd->wireBytes;
+  }
+  // bytes of whole update
+  lcd->wireBytes = wireBytes;
+
+  // request succesfull
+  if (SSD1306_SUCCESS != status) {
+    // transaction closed, pages not sent kept for next update
+    SSD1306_Batch_Drop (lcd);
+    // error
+    return status;
+  }
+
+  // send pages and start line, by outer SSD1306_End if nested
+  status = SSD1306_End (lcd);
+  // request succesfull
+  if (SSD1306_SUCCESS != status) {
+    // error
+    return status;
+  }
+
+  // display is up to date, or ranges are queued by outer block
+  SSD1306_MarkScreen (lcd, 0);
+
+  // success
+  return SSD1306_SUCCESS;
+}
+#endif
+
+/**
+ * @desc    SSD1306 Update screen, in page-buffer mode pages are rendered from display list
+ *
+ * @param   SSD1306_Display *
+ *
+ * @return  uint8_t
+ */
+uint8_t SSD1306_UpdateScreen (SSD1306_Display *lcd)
+{
+#ifdef SSD1306_PAGE_BUFFER
+  // pages rendered from display list one by one
+  return SSD1306_Render (lcd);
+#else
+  // send dirty ranges of cache
+  uint8_t status = SSD1306_UpdateFrame (lcd, lcd->cacheMemLcd, lcd->dirtyStart, lcd->dirtyEnd);
+  // request succesfull
+  if (SSD1306_SUCCESS != status) {
+    // dirty ranges kept for next update
+    return status;
+  }
+
+  // display is up to date, or ranges are queued by outer block
+  SSD1306_MarkScreen (lcd, 0);
+
+  // success
+  return SSD1306_SUCCESS;
+#endif
+}
+
+/**
+ * @desc    SSD1306 Get number of bytes put on the wire by the last update
+ *
+ * @param   SSD1306_Display *
+ *
+ * @return  uint16_t
+ */
+uint16_t SSD1306_GetWireBytes (SSD1306_Display *lcd)
+{
+  // control bytes, commands and data
+  return lcd->wireBytes;
+}
+
+/**
+ * @desc    SSD1306 Start continuous scroll on display, no data is sent while scrolling
+ *          - pending changes are sent first, display scrolls content of cache
+ *          - pages of horizontal scroll are not updated until scroll stops
+ *
+ * @param   SSD1306_Display *
+ * @param   uint8_t SSD1306_SCROLL_RIGHT / SSD1306_SCROLL_LEFT
+ * @param   uint8_t first page
+ * @param   uint8_t last page
+ * @param   uint16_t frames per step, nearest lower interval of display is used
+ * @param   uint8_t rows per step of vertical scroll, 0 horizontal only
+ *
+ * @return  uint8_t
+ */
+uint8_t SSD1306_StartScroll (SSD1306_Display *lcd, uint8_t direction, uint8_t start, uint8_t end, uint16_t frames, uint8_t rows)
+{
+  // scroll setup
+  uint8_t commands[16];
+  uint8_t length = 0;
+  // scroll command
+  uint8_t command;
+  // interval setting
+  uint8_t interval = 7;
+  uint8_t i;
+  // status
+  uint8_t status;
+
+  // display owned by flush thread
+  if (SSD1306_Foreign (lcd)) {
+    // error
+    return SSD1306_ERROR;
+  }
+  // check parameters
+  if (((direction != SSD1306_SCROLL_RIGHT) && (direction != SSD1306_SCROLL_LEFT)) ||
+      (start > end) || (end >= lcd->pages) || (rows >= (lcd->pages << 3))) {
+    // error
+    return SSD1306_ERROR;
+  }
+
+  // longest interval not above requested frames
+  for (i = 0; i < 8; i++) {
+    if ((SCROLL_FRAMES[i] <= frames) && (SCROLL_FRAMES[i] > SCROLL_FRAMES[interval])) {
+      interval = i;
+    }
+  }
+  // horizontal or vertical and horizontal scroll
+  if (rows) {
+    command = (direction == SSD1306_SCROLL_RIGHT) ? SSD1306_SCROLL_VERT_RIGHT : SSD1306_SCROLL_VERT_LEFT;
+  } else {
+    command = direction;
+  }
+
+  // same scroll running, only pending changes sent
+  if (lcd->scrollActive && (command == lcd->scrollCommand) && (start == lcd->scrollStart) && 
+      (end == lcd->scrollEnd) && (SCROLL_FRAMES[interval] == lcd->scrollFrames) && (rows == lcd->scrollRows)) {
+    // status
+    return SSD1306_UpdateScreen (lcd);
+  }
+
+  // running scroll stopped, cache follows display
+  status = SSD1306_StopScroll (lcd);
+  // request succesfull
+  if (SSD1306_SUCCESS != status) {
+    // error
+    return status;
+  }
+  // display shows cache, update and setup in one transaction
+  SSD1306_Batch_Begin (lcd);
+  status = SSD1306_UpdateScreen (lcd);
+  // request succesfull
+  if (SSD1306_SUCCESS != status) {
+    // transaction closed
+    SSD1306_Batch_Drop (lcd);
+    // error
+    return status;
+  }
+
+  // scroll has to be deactivated before setup
+  commands[length++] = SSD1306_DEACT_SCROLL;
+  // vertical scroll over whole screen
+  if (rows) {
+    commands[length++] = SSD1306_VERT_SCROLL_AREA;
+    commands[length++] = 0;
+    commands[length++] = lcd->pages << 3;
+  }
+  commands[length++] = command;
+  commands[length++] = 0x00;
+  commands[length++] = start;
+  commands[length++] = interval;
+  commands[length++] = end;
+  // vertical offset / dummy bytes
+  if (rows) {
+    commands[length++] = rows;
+  } else {
+    commands[length++] = 0x00;
+    commands[length++] = 0xFF;
+  }
+  commands[length++] = SSD1306_ACTIVE_SCROLL;
+
+  // send update and setup
+  status = SSD1306_Send_Commands (lcd, commands, length);
+  if (SSD1306_SUCCESS == status) {
+    status = SSD1306_End (lcd);
+  } else {
+    SSD1306_Batch_Drop (lcd);
+  }
+  // request succesfull
+  if (SSD1306_SUCCESS != status) {
+    // content of display unknown
+    SSD1306_MarkScreen (lcd, 1);
+    // error
+    return status;
+  }
+
+  // scroll running
+  clock_gettime (CLOCK_MONOTONIC, &lcd->scrollSince);
+  lcd->scrollActive = 1;
+  lcd->scrollCommand = command;
+  lcd->scrollStart = start;
+  lcd->scrollEnd = end;
+  lcd->scrollFrames = SCROLL_FRAMES[interval];
+  lcd->scrollRows = rows;
+  // RAM pointer not relied on while display moves RAM
+  lcd->stateValid &= ~SSD1306_STATE_WINDOW;
+  lcd->pointer.valid = 0;
+
+  // success
+  return SSD1306_SUCCESS;
+}
+
+/**
+ * @desc    SSD1306 Stop scroll
+ *          - pages of horizontal scroll in cache are moved by steps done by display
+ *            (estimated from elapsed time and SSD1306_FRAME_HZ)
+ *          - display RAM has to be rewritten after scroll, scrolled pages are sent
+ *            from cache, so display shows cache exactly
+ *          - in page-buffer mode scrolled pages are rendered again where they were drawn
+ *
+ * @param   SSD1306_Display *
+ *
+ * @return  uint8_t
+ */
+uint8_t SSD1306_StopScroll (SSD1306_Display *lcd)
+{
+  // stop, vertical scroll back to start line
+  uint8_t commands[2] = { SSD1306_DEACT_SCROLL, SSD1306_SET_START_LINE };
+#ifndef SSD1306_PAGE_BUFFER
+  // copy of page
+  uint8_t row[RAM_X_END];
+  uint8_t *cache;
+  // elapsed time, steps done by display
+  struct timespec now;
+  uint64_t elapsed_us, steps;
+  // columns moved
+  uint8_t shift;
+  // queued by outer block - content copied
+  uint8_t copy;
+#endif
+  uint8_t page;
+  // status
+  uint8_t status;
+
+  // display owned by flush thread
+  if (SSD1306_Foreign (lcd)) {
+    // error
+    return SSD1306_ERROR;
+  }
+  // no scroll
+  if (!lcd->scrollActive) {
+    // success
+    return SSD1306_SUCCESS;
+  }
+
+  // nothing sent yet
+  lcd->wireBytes = 0;
+  commands[1] |= lcd->startLineSent;
+
+  // stop scroll
+  status = SSD1306_Send_Commands (lcd, commands, lcd->scrollCommand > SSD1306_SCROLL_LEFT ? 2 : 1);
+#ifndef SSD1306_PAGE_BUFFER
+  clock_gettime (CLOCK_MONOTONIC, &now);
+#endif
+  // request succesfull
+  if (SSD1306_SUCCESS != status) {
+    // error
+    return status;
+  }
+  lcd->scrollActive = 0;
+
+#ifdef SSD1306_PAGE_BUFFER
+  // display list is not moved, scrolled pages rendered again where they were drawn
+  for (page = lcd->scrollStart; page <= lcd->scrollEnd; page++) {
+    lcd->shadowValid &= ~(1 << page);
+    SSD1306_MarkDirty (lcd, page, START_COLUMN_ADDR, END_COLUMN_ADDR);
+  }
+  // status
+  return SSD1306_UpdateScreen (lcd);
+#else
+
+  // steps = elapsed / (frames * rows / (FRAME_HZ * 64))
+  elapsed_us = (uint64_t) (now.tv_sec - lcd->scrollSince.tv_sec) * 1000000 
+             + (now.tv_nsec - lcd->scrollSince.tv_nsec) / 1000;
+  steps = elapsed_us * SSD1306_FRAME_HZ * 64 / ((uint64_t) 1000000 * (lcd->pages << 3) * lcd->scrollFrames);
+  // one column per step
+  shift = steps % RAM_X_END;
+  if ((SSD1306_SCROLL_LEFT == lcd->scrollCommand) || (SSD1306_SCROLL_VERT_LEFT == lcd->scrollCommand)) {
+    shift = (RAM_X_END - shift) % RAM_X_END;
+  }
+
+  // move pages of cache to the right
+  for (page = lcd->scrollStart; page <= lcd->scrollEnd; page++) {
+    cache = lcd->cacheMemLcd + CACHE_INDEX (0, page);
+    memcpy (row, cache, RAM_X_END);
+    memcpy (cache + shift, row, RAM_X_END - shift);
+    memcpy (cache, row + RAM_X_END - shift, shift);
+  }
+
+  // rewrite scrolled pages, addressing mode of display set again after error
+  copy = lcd->batchDepth ? 1 : 0;
+  SSD1306_Batch_Begin (lcd);
+  status = SSD1306_Set_AddrMode (lcd, lcd->addrMode);
+  if (SSD1306_SUCCESS == status) {
+    status = SSD1306_Send_Window (lcd, lcd->cacheMemLcd, START_COLUMN_ADDR, END_COLUMN_ADDR, lcd->scrollStart, lcd->scrollEnd, copy);
+  }
+  if (SSD1306_SUCCESS == status) {
+    status = SSD1306_End (lcd);
+  } else {
+    SSD1306_Batch_Drop (lcd);
+  }
+  // request succesfull
+  if (SSD1306_SUCCESS != status) {
+    // content of display unknown
+    lcd->shadowValid = 0;
+    SSD1306_MarkScreen (lcd, 1);
+    // error
+    return status;
+  }
+
+  // remember sent pages, queued pages marked dirty again if outer block fails
+  memcpy (lcd->shadowMemLcd + lcd->scrollStart * PAGE_SIZE_MEM, lcd->cacheMemLcd + lcd->scrollStart * PAGE_SIZE_MEM, 
+          (lcd->scrollEnd - lcd->scrollStart + 1) * PAGE_SIZE_MEM);
+  for (page = lcd->scrollStart; page <= lcd->scrollEnd; page++) {
+    lcd->shadowValid |= 1 << page;
+    if (copy) {
+      SSD1306_Batch_Queue (lcd, page, START_COLUMN_ADDR, END_COLUMN_ADDR);
+    }
+  }
+
+  // success
+  return SSD1306_SUCCESS;
+#endif
+}
+
+/**
+ * @desc    SSD1306 Clear screen, in page-buffer mode display list is emptied and only
+ *          columns drawn by its calls are sent again
+ *
+ * @param   SSD1306_Display *
+ *
+ * @return  void
+ */
+void SSD1306_ClearScreen (SSD1306_Display *lcd)
+{
+  // null cache memory lcd
+  SSD1306_ClearCache (lcd->cacheMemLcd);
+#ifdef SSD1306_PAGE_BUFFER
+  // columns drawn by recorded calls changed, rest of screen is empty on display
+  SSD1306_Replay_List (lcd, SSD1306_BAND_NONE);
+  // empty display list
+  lcd->listCount = 0;
+  lcd->listTextLength = 0;
+#else
+  // whole screen changed
+  SSD1306_MarkScreen (lcd, 1);
+#endif
+}
+
+/**
+ * @desc    SSD1306 Set RAM row shown on top of display, sent by next update after content
+ *
+ * @param   SSD1306_Display *
+ * @param   uint8_t row of RAM 0 ... 63
+ *
+ * @return  void
+ */
+void SSD1306_SetStartLine (SSD1306_Display *lcd, uint8_t line)
+{
+  // start line sent by flush thread
+  if (SSD1306_Foreign (lcd)) {
+    return;
+  }
+  // 64 rows of RAM
+  lcd->startLine = line & 0x3F;
+}
+
+/**
+ * @desc    SSD1306 Set drawing mode of pixels, lines, rectangles, text and bitmaps
+ *
+ * @param   SSD1306_Display *
+ * @param   uint8_t SSD1306_MODE_*
+ *
+ * @return  void
+ */
+void SSD1306_SetDrawMode (SSD1306_Display *lcd, uint8_t mode)
+{
+  // unknown mode draws
+  lcd->mode = (mode > SSD1306_MODE_INVERT) ? SSD1306_MODE_SET : mode;
+}
+
+/**
+ * @desc    SSD1306 Set position
+ *
+ * @param   SSD1306_Display *
+ * @param   uint8_t column -> 0 ... 127 
+ * @param   uint8_t page -> 0 ... 7 or 3 
+ *
+ * @return  void
+ */
+void SSD1306_SetPosition (SSD1306_Display *lcd, uint8_t x, uint8_t y) 
+{
+  // calculate counter
+  lcd->counter = x + (y << 7);
+}
+
+/**
+ * @desc    SSD1306 Update text poisition - this ensure that character will not be divided at the end of row, 
+ *          the whole character will be depicted on the new row
+ *
+ * @param   SSD1306_Display *
+ *
+ * @return  uint8_t
+ */
+uint8_t SSD1306_UpdatePosition (SSD1306_Display *lcd) 
+{
+  // y / 8
+  uint8_t y = lcd->counter >> 7;
+  // y % 8
+  uint8_t x = lcd->counter - (y << 7);
+  // x + character length + 1
+  uint8_t x_new = x + lcd->glyphs->width + 1;
+
+  // check position
+  if (x_new > END_COLUMN_ADDR) {
+    // if more than allowable number of pages
+    if (y >= lcd->pages) {
+      // return out of range
+      return SSD1306_ERROR;
+    // if x reach the end but page in range
+    } else if (y < (lcd->pages - 2)) {
+      // update
+      lcd->counter = ((++y) << 7);
+    }
+  }
+ 
+  // success
+  return SSD1306_SUCCESS;
+}
+
+/**
+ * @desc    SSD1306 Draw character
+ *
+ * @param   SSD1306_Display *
+ * @param   char character
+ *
+ * @return  uint8_t
+ */
+uint8_t SSD1306_DrawChar (SSD1306_Display *lcd, char character)
+{
+  // default font
+  const SSD1306_Font *font = lcd->glyphs->font;
+
+#ifdef SSD1306_PAGE_BUFFER
+  // recorded into display list, drawn page by page by update
+  if (SSD1306_BAND_IDLE == lcd->band) {
+    // joined to string of previous characters
+    const char str[2] = { character, '\0' };
+    return SSD1306_Record_String (lcd, str);
+  }
+#endif
+
+  // character out of font
+  if (((uint8_t) character < font->first) || ((uint8_t) character > font->last)) {
+    // error
+    return SSD1306_ERROR;
+  }
+
+  // update text position
+  // this ensure that character will not be divided at the end of row, the whole character will be depicted on the new row
+  if (SSD1306_UpdatePosition (lcd) == SSD1306_ERROR) {
+    // error
+    return SSD1306_ERROR;
+  }
+
+  // pre-expanded upper and lower page
+  SSD1306_BlitMode (lcd, lcd->counter & END_COLUMN_ADDR, (lcd->counter >> 7) << 3,
+                    lcd->glyphs->glyphs + ((uint8_t) character - font->first) * lcd->glyphs->size,
+                    lcd->glyphs->width, lcd->glyphs->pages << 3, SSD1306_TEXT_MODE (lcd->mode));
+  lcd->counter += lcd->glyphs->width;
+
+  // update position
+  lcd->counter++;
+
+  // success
+  return SSD1306_SUCCESS;
+}
+
+/**
+ * @desc    SSD1306 Draw String, in page-buffer mode recorded as one call
+ *
+ * @param   SSD1306_Display *
  * @param   char * string
  *
- * @return  void
+ * @return  uint8_t
  */
-void SSD1306_DrawString (char *str)
+uint8_t SSD1306_DrawString (SSD1306_Display *lcd, char *str)
 {
   // init
   int i = 0;
+  // status
+  uint8_t status = SSD1306_SUCCESS;
+
+#ifdef SSD1306_PAGE_BUFFER
+  // recorded into display list, drawn page by page by update
+  if (SSD1306_BAND_IDLE == lcd->band) {
+    return SSD1306_Record_String (lcd, str);
+  }
+#endif
+
   // loop through character of string
   while (str[i] != '\0') {
     // draw string
-    SSD1306_DrawChar (str[i++]);
+    if (SSD1306_SUCCESS != SSD1306_DrawChar (lcd, str[i++])) {
+      status = SSD1306_ERROR;
+    }
+  }
+
+  // status
+  return status;
+}
+
+/**
+ * @desc    SSD1306 Draw glyphs of text, mode is constant after inlining
+ *
+ * @param   SSD1306_Display *
+ * @param   int16_t x
+ * @param   int16_t y
+ * @param   const SSD1306_Glyphs *
+ * @param   const char * string
+ * @param   uint8_t SSD1306_MODE_*
+ *
+ * @return  void
+ */
+static inline __attribute__((always_inline)) void SSD1306_Text (SSD1306_Display *lcd, int16_t x, int16_t y, const SSD1306_Glyphs *glyphs, const char *str, uint8_t mode)
+{
+  const SSD1306_Font *font = glyphs->font;
+  uint8_t character;
+
+  // loop through characters until right edge
+  while (*str && (x < RAM_X_END)) {
+    character = *str++;
+    // characters out of font are skipped
+    if ((character >= font->first) && (character <= font->last)) {
+      SSD1306_Blit (lcd, x, y, glyphs->glyphs + (character - font->first) * glyphs->size, glyphs->width, glyphs->pages << 3, mode);
+    }
+    // glyph and space
+    x += glyphs->width + glyphs->sx;
+  }
+}
+
+/**
+ * @desc    SSD1306 Draw text in font and scale at pixel position, clipped to screen
+ *
+ * @param   SSD1306_Display *
+ * @param   int16_t x
+ * @param   int16_t y
+ * @param   const SSD1306_Font *
+ * @param   uint8_t scale 1 ... 4
+ * @param   const char * string
+ *
+ * @return  uint8_t
+ */
+uint8_t SSD1306_DrawText (SSD1306_Display *lcd, int16_t x, int16_t y, const SSD1306_Font *font, uint8_t scale, const char *str)
+{
+  // glyphs of font / scale pair
+  const SSD1306_Glyphs *glyphs = SSD1306_GetGlyphs (font, scale, scale);
+
+#ifdef SSD1306_PAGE_BUFFER
+  // recorded into display list, drawn page by page by update
+  if (SSD1306_BAND_IDLE == lcd->band) {
+    return SSD1306_Record (lcd, SSD1306_OP_TEXT, x, y, 0, scale, font, str);
+  }
+#endif
+
+  // scale out of range or out of memory
+  if (!glyphs) {
+    // error
+    return SSD1306_ERROR;
+  }
+
+  // one specialized loop per mode, glyph cell replaced in SSD1306_MODE_SET
+  switch (lcd->mode) {
+    case SSD1306_MODE_CLEAR:
+      SSD1306_Text (lcd, x, y, glyphs, str, SSD1306_MODE_CLEAR);
+      break;
+    case SSD1306_MODE_XOR:
+      SSD1306_Text (lcd, x, y, glyphs, str, SSD1306_MODE_XOR);
+      break;
+    case SSD1306_MODE_INVERT:
+      SSD1306_Text (lcd, x, y, glyphs, str, SSD1306_MODE_INVERT);
+      break;
+    default:
+      SSD1306_Text (lcd, x, y, glyphs, str, SSD1306_MODE_COPY);
+      break;
   }
+
+  // success
+  return SSD1306_SUCCESS;
+}
+
+/**
+ * @desc    SSD1306 Width of text in font and scale
+ *
+ * @param   const SSD1306_Font *
+ * @param   uint8_t scale
+ * @param   const char * string
+ *
+ * @return  int16_t
+ */
+int16_t SSD1306_TextWidth (const SSD1306_Font *font, uint8_t scale, const char *str)
+{
+  // number of characters
+  int16_t length = strlen (str);
+
+  // glyphs and spaces between them
+  return length ? length * (font->width + 1) * scale - scale : 0;
 }
 
 /**
  * @desc    Draw pixel
  *
+ * @param   SSD1306_Display *
  * @param   uint8_t x -> 0 ... MAX_X
  * @param   uint8_t y -> 0 ... MAX_Y
  *
  * @return  uint8_t
  */
-uint8_t SSD1306_DrawPixel (uint8_t x, uint8_t y)
+uint8_t SSD1306_DrawPixel (SSD1306_Display *lcd, uint8_t x, uint8_t y)
 {
   uint8_t page = 0;
   uint8_t pixel = 0;
 
+#ifdef SSD1306_PAGE_BUFFER
+  // recorded into display list, drawn page by page by update
+  if (SSD1306_BAND_IDLE == lcd->band) {
+    return SSD1306_Record (lcd, SSD1306_OP_PIXEL, x, y, 0, 0, NULL, NULL);
+  }
+#endif
+
   // if out of range
-  if ((x > MAX_X) && (y > MAX_Y)) {
+  if ((x > MAX_X) || (y >= (lcd->pages << 3))) {
     // out of range
     return SSD1306_ERROR;
   }
@@ -530,37 +2903,400 @@ uint8_t SSD1306_DrawPixel (uint8_t x, uint8_t y)
   // which pixel (y % 8)
   pixel = 1 << (y - (page << 3));
   // update counter
-  _counter = x + (page << 7);
-  // save pixel
-  cacheMemLcd[_counter++] |= pixel;
+  lcd->counter = x + (page << 7);
+  // save pixel in drawing mode
+  if (SSD1306_Band (lcd, page)) {
+    lcd->cacheMemLcd[CACHE_INDEX (x, page)] = SSD1306_Rop (lcd->cacheMemLcd[CACHE_INDEX (x, page)], pixel, pixel, lcd->mode);
+  }
+  lcd->counter++;
+  // mark column
+  SSD1306_MarkDirty (lcd, page, x, x);
 
   // success
   return SSD1306_SUCCESS;
 }
 
 /**
- * @desc    Draw line by Bresenham algoritm
- *  
- * @param   uint8_t x start position / 0 <= cols <= MAX_X-1
- * @param   uint8_t x end position   / 0 <= cols <= MAX_X-1
- * @param   uint8_t y start position / 0 <= rows <= MAX_Y-1 
- * @param   uint8_t y end position   / 0 <= rows <= MAX_Y-1
+ * @desc    Fill clipped rectangle - whole page bytes, masks for partial pages
+ *
+ * @param   SSD1306_Display *
+ * @param   int16_t first column
+ * @param   int16_t first row
+ * @param   int16_t last column
+ * @param   int16_t last row
+ * @param   uint8_t SSD1306_MODE_*
+ *
+ * @return  void
+ */
+static inline __attribute__((always_inline)) void SSD1306_Fill (SSD1306_Display *lcd, int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint8_t mode)
+{
+  // pages
+  uint8_t p0 = y0 >> 3;
+  uint8_t p1 = y1 >> 3;
+  uint8_t page;
+  // mask of first and last page
+  uint8_t top = TOP_MASK[y0 & 7];
+  uint8_t bottom = BOTTOM_MASK[y1 & 7];
+  uint8_t *dst;
+  int16_t i;
+
+  // one page
+  if (p0 == p1) {
+    top &= bottom;
+  }
+  // first page
+  dst = lcd->cacheMemLcd + CACHE_INDEX (0, p0);
+  for (i = x0; (i <= x1) && SSD1306_Band (lcd, p0); i++) {
+    dst[i] = SSD1306_Rop (dst[i], top, top, mode);
+  }
+  SSD1306_MarkDirty (lcd, p0, x0, x1);
+  // one page
+  if (p0 == p1) {
+    return;
+  }
+  // whole pages
+  for (page = p0 + 1; page < p1; page++) {
+    dst = lcd->cacheMemLcd + CACHE_INDEX (0, page);
+    SSD1306_MarkDirty (lcd, page, x0, x1);
+    // page not rendered
+    if (!SSD1306_Band (lcd, page)) {
+      continue;
+    }
+    if (SSD1306_MODE_SET == mode) {
+      memset (dst + x0, 0xFF, x1 - x0 + 1);
+    } else if (SSD1306_MODE_CLEAR == mode) {
+      memset (dst + x0, 0x00, x1 - x0 + 1);
+    } else {
+      SSD1306_Flip (dst + x0, x1 - x0 + 1);
+    }
+  }
+  // last page
+  dst = lcd->cacheMemLcd + CACHE_INDEX (0, p1);
+  for (i = x0; (i <= x1) && SSD1306_Band (lcd, p1); i++) {
+    dst[i] = SSD1306_Rop (dst[i], bottom, bottom, mode);
+  }
+  SSD1306_MarkDirty (lcd, p1, x0, x1);
+}
+
+/**
+ * @desc    Fill rectangle in drawing mode, clipped to screen
+ *
+ * @param   SSD1306_Display *
+ * @param   int16_t x
+ * @param   int16_t y
+ * @param   int16_t width
+ * @param   int16_t height
+ *
+ * @return  uint8_t
+ */
+uint8_t SSD1306_FillRect (SSD1306_Display *lcd, int16_t x, int16_t y, int16_t w, int16_t h)
+{
+  // clipped corners
+  int16_t x0 = x < 0 ? 0 : x;
+  int16_t y0 = y < 0 ? 0 : y;
+  int16_t x1 = (x + w > RAM_X_END) ? END_COLUMN_ADDR : x + w - 1;
+  int16_t y1 = (y + h > (lcd->pages << 3)) ? (lcd->pages << 3) - 1 : y + h - 1;
+
+#ifdef SSD1306_PAGE_BUFFER
+  // recorded into display list, drawn page by page by update
+  if (SSD1306_BAND_IDLE == lcd->band) {
+    return SSD1306_Record (lcd, SSD1306_OP_FILL, x, y, w, h, NULL, NULL);
+  }
+#endif
+
+  // nothing visible
+  if ((x0 > x1) || (y0 > y1)) {
+    // success
+    return SSD1306_SUCCESS;
+  }
+
+  // one specialized fill per mode
+  switch (lcd->mode) {
+    case SSD1306_MODE_CLEAR:
+      SSD1306_Fill (lcd, x0, y0, x1, y1, SSD1306_MODE_CLEAR);
+      break;
+    case SSD1306_MODE_XOR:
+    case SSD1306_MODE_INVERT:
+      SSD1306_Fill (lcd, x0, y0, x1, y1, SSD1306_MODE_XOR);
+      break;
+    default:
+      SSD1306_Fill (lcd, x0, y0, x1, y1, SSD1306_MODE_SET);
+      break;
+  }
+
+  // success
+  return SSD1306_SUCCESS;
+}
+
+/**
+ * @desc    Draw horizontal line
+ *
+ * @param   SSD1306_Display *
+ * @param   int16_t x
+ * @param   int16_t y
+ * @param   int16_t width
+ *
+ * @return  uint8_t
+ */
+uint8_t SSD1306_DrawHLine (SSD1306_Display *lcd, int16_t x, int16_t y, int16_t w)
+{
+  // rectangle of height 1
+  return SSD1306_FillRect (lcd, x, y, w, 1);
+}
+
+/**
+ * @desc    Draw vertical line
+ *
+ * @param   SSD1306_Display *
+ * @param   int16_t x
+ * @param   int16_t y
+ * @param   int16_t height
+ *
+ * @return  uint8_t
+ */
+uint8_t SSD1306_DrawVLine (SSD1306_Display *lcd, int16_t x, int16_t y, int16_t h)
+{
+  // rectangle of width 1
+  return SSD1306_FillRect (lcd, x, y, 1, h);
+}
+
+/**
+ * @desc    Draw rectangle outline
+ *
+ * @param   SSD1306_Display *
+ * @param   int16_t x
+ * @param   int16_t y
+ * @param   int16_t width
+ * @param   int16_t height
+ *
+ * @return  uint8_t
+ */
+uint8_t SSD1306_DrawRect (SSD1306_Display *lcd, int16_t x, int16_t y, int16_t w, int16_t h)
+{
+  // status
+  uint8_t status = SSD1306_SUCCESS;
+
+  // empty rectangle
+  if ((w <= 0) || (h <= 0)) {
+    // success
+    return SSD1306_SUCCESS;
+  }
+  // top and bottom edge, every pixel drawn once (xor)
+  status = SSD1306_DrawHLine (lcd, x, y, w);
+  if ((SSD1306_SUCCESS == status) && (h > 1)) {
+    status = SSD1306_DrawHLine (lcd, x, y + h - 1, w);
+  }
+  // left and right edge between top and bottom edge
+  if ((SSD1306_SUCCESS == status) && (h > 2)) {
+    status = SSD1306_DrawVLine (lcd, x, y + 1, h - 2);
+    if ((SSD1306_SUCCESS == status) && (w > 1)) {
+      status = SSD1306_DrawVLine (lcd, x + w - 1, y + 1, h - 2);
+    }
+  }
+
+  // status
+  return status;
+}
+
+/**
+ * @desc    Mark column range of page as dirty, columns in any order
+ *
+ * @param   SSD1306_Display *
+ * @param   uint8_t page
+ * @param   uint8_t column
+ * @param   uint8_t column
+ *
+ * @return  void
+ */
+static inline void SSD1306_MarkSpan (SSD1306_Display *lcd, uint8_t page, uint8_t a, uint8_t b)
+{
+  // ordered range
+  if (a < b) {
+    SSD1306_MarkDirty (lcd, page, a, b);
+  } else {
+    SSD1306_MarkDirty (lcd, page, b, a);
+  }
+}
+
+/**
+ * @desc    Draw vertical run of line - one masked byte per page
+ *
+ * @param   SSD1306_Display *
+ * @param   uint8_t x
+ * @param   uint8_t y of first pixel
+ * @param   uint8_t y of last pixel, any order
+ * @param   uint8_t SSD1306_MODE_*
+ *
+ * @return  void
+ */
+static inline __attribute__((always_inline)) void SSD1306_DrawRun (SSD1306_Display *lcd, uint8_t x, uint8_t a, uint8_t b, uint8_t mode)
+{
+  // page byte
+  uint8_t *dst;
+  // pages
+  uint8_t page, last;
+  // mask of first page
+  uint8_t mask;
+
+  // top to bottom
+  if (a > b) {
+    page = a; a = b; b = page;
+  }
+  page = a >> 3;
+  last = b >> 3;
+  dst = lcd->cacheMemLcd + CACHE_INDEX (x, page);
+  mask = TOP_MASK[a & 7];
+  // whole pages
+  while (page < last) {
+    if (SSD1306_Band (lcd, page)) {
+      *dst = SSD1306_Rop (*dst, mask, mask, mode);
+    }
+    SSD1306_MarkDirty (lcd, page, x, x);
+    mask = 0xFF;
+    dst += CACHE_STRIDE;
+    page++;
+  }
+  // last page
+  mask &= BOTTOM_MASK[b & 7];
+  if (SSD1306_Band (lcd, page)) {
+    *dst = SSD1306_Rop (*dst, mask, mask, mode);
+  }
+  SSD1306_MarkDirty (lcd, page, x, x);
+}
+
+/**
+ * @desc    Clamp value into range
+ *
+ * @param   int16_t value
+ * @param   int16_t min
+ * @param   int16_t max
+ *
+ * @return  int16_t
+ */
+static inline int16_t SSD1306_Clamp (int16_t value, int16_t min, int16_t max)
+{
+  // clamped value
+  return value < min ? min : (value > max ? max : value);
+}
+
+/**
+ * @desc    Clip line to screen - Liang-Barsky on Bresenham steps, visible steps
+ *          draw same pixels as unclipped line. Minor offset after j steps along
+ *          major axis is k = (2*minor*j + major) / (2*major)
+ *
+ * @param   int32_t major coordinate of start
+ * @param   int32_t minor coordinate of start
+ * @param   int8_t major direction
+ * @param   int8_t minor direction
+ * @param   int32_t major delta (number of steps)
+ * @param   int32_t minor delta
+ * @param   int32_t last major coordinate of screen
+ * @param   int32_t last minor coordinate of screen
+ * @param   int32_t * first visible step
+ * @param   int32_t * last visible step
  *
  * @return  uint8_t
  */
-uint8_t SSD1306_DrawLine (uint8_t x1, uint8_t x2, uint8_t y1, uint8_t y2)
+static uint8_t SSD1306_ClipLine (int32_t a, int32_t b, int8_t trace_a, int8_t trace_b, int32_t delta_a, int32_t delta_b, int32_t max_a, int32_t max_b, int32_t *first, int32_t *last)
+{
+  // visible steps along major axis
+  int32_t lo = (trace_a > 0) ? -a : a - max_a;
+  int32_t hi = (trace_a > 0) ? max_a - a : a;
+  // visible offsets along minor axis
+  int32_t k_lo = (trace_b > 0) ? -b : b - max_b;
+  int32_t k_hi = (trace_b > 0) ? max_b - b : b;
+
+  // within line
+  if (lo < 0) {
+    lo = 0;
+  }
+  if (hi > delta_a) {
+    hi = delta_a;
+  }
+  if (k_lo < 0) {
+    k_lo = 0;
+  }
+  if (k_hi > delta_b) {
+    k_hi = delta_b;
+  }
+  // first step with k >= k_lo
+  if (k_lo > 0) {
+    k_lo = ((int64_t) 2 * delta_a * k_lo - delta_a + 2 * delta_b - 1) / (2 * delta_b);
+    lo = k_lo > lo ? k_lo : lo;
+  }
+  // last step with k <= k_hi
+  if (k_hi < delta_b) {
+    k_hi = k_hi < 0 ? -1 : ((int64_t) 2 * delta_a * k_hi + delta_a - 1) / (2 * delta_b);
+    hi = k_hi < hi ? k_hi : hi;
+  }
+  // nothing visible
+  if (lo > hi) {
+    return SSD1306_ERROR;
+  }
+  *first = lo;
+  *last = hi;
+
+  // success
+  return SSD1306_SUCCESS;
+}
+
+/**
+ * @desc    Draw line by Bresenham algoritm, clipped to screen once
+ *          - shallow line walks page bytes by pointer (+-1 column, +-128 page)
+ *          - steep line is drawn by vertical runs, one masked byte per page
+ *  
+ * @param   SSD1306_Display *
+ * @param   int16_t x start position
+ * @param   int16_t x end position
+ * @param   int16_t y start position
+ * @param   int16_t y end position
+ * @param   uint8_t SSD1306_MODE_*
+ *
+ * @return  uint8_t SSD1306_ERROR if nothing visible
+ */
+static inline __attribute__((always_inline)) uint8_t SSD1306_Line (SSD1306_Display *lcd, int16_t x1, int16_t x2, int16_t y1, int16_t y2, uint8_t mode)
 {
   // determinant
-  int16_t D;
+  int32_t D;
   // deltas
-  int16_t delta_x, delta_y;
+  int32_t delta_x, delta_y;
   // steps
-  int16_t trace_x = 1, trace_y = 1;
+  int8_t trace_x = 1, trace_y = 1;
+  // page step of pointer
+  int16_t trace_page = CACHE_STRIDE;
+  // first and last visible step, minor offset of first step
+  int32_t first, last, k;
+  // last row of screen
+  int16_t max_y = (lcd->pages << 3) - 1;
+  // page byte of current pixel
+  uint8_t *dst;
+  // bit of current pixel
+  uint8_t bit;
+  // current page, first column of line on current page
+  uint8_t page, from;
+  // first row of vertical run
+  int16_t run;
+  // any endpoint out of screen
+  uint8_t outside = (x1 < 0) || (x1 > END_COLUMN_ADDR) || (x2 < 0) || (x2 > END_COLUMN_ADDR) ||
+                    (y1 < 0) || (y1 > max_y) || (y2 < 0) || (y2 > max_y);
+
+  // horizontal line, endpoints clamped just outside screen
+  if (y1 == y2) {
+    x1 = SSD1306_Clamp (x1, -1, RAM_X_END);
+    x2 = SSD1306_Clamp (x2, -1, RAM_X_END);
+    return SSD1306_DrawHLine (lcd, x1 < x2 ? x1 : x2, y1, (x1 < x2 ? x2 - x1 : x1 - x2) + 1);
+  }
+  // vertical line, endpoints clamped just outside screen
+  if (x1 == x2) {
+    y1 = SSD1306_Clamp (y1, -1, max_y + 1);
+    y2 = SSD1306_Clamp (y2, -1, max_y + 1);
+    return SSD1306_DrawVLine (lcd, x1, y1 < y2 ? y1 : y2, (y1 < y2 ? y2 - y1 : y1 - y2) + 1);
+  }
 
   // delta x
-  delta_x = x2 - x1;
+  delta_x = (int32_t) x2 - x1;
   // delta y
-  delta_y = y2 - y1;
+  delta_y = (int32_t) y2 - y1;
 
   // check if x2 > x1
   if (delta_x < 0) {
@@ -576,72 +3312,313 @@ uint8_t SSD1306_DrawLine (uint8_t x1, uint8_t x2, uint8_t y1, uint8_t y2)
     delta_y = -delta_y;
     // negate step y
     trace_y = -trace_y;
+    // negate step page
+    trace_page = -trace_page;
   }
 
   // Bresenham condition for m < 1 (dy < dx)
   if (delta_y < delta_x) {
     // calculate determinant
     D = (delta_y << 1) - delta_x;
+    // line leaves screen
+    if (outside) {
+      // visible steps along x
+      if (SSD1306_ClipLine (x1, y1, trace_x, trace_y, delta_x, delta_y, END_COLUMN_ADDR, max_y, &first, &last)) {
+        // out of screen
+        return SSD1306_ERROR;
+      }
+      // move to first visible step
+      k = ((int64_t) 2 * delta_y * first + delta_x) / (2 * delta_x);
+      x2 = x1 + trace_x * last;
+      x1 += trace_x * first;
+      y1 += trace_y * k;
+      // determinant of first visible step
+      D += (int64_t) 2 * delta_y * first - (int64_t) 2 * delta_x * k;
+    }
+    // first pixel
+    page = y1 >> 3;
+    from = x1;
+    dst = lcd->cacheMemLcd + CACHE_INDEX (x1, page);
+    bit = 1 << (y1 & 7);
     // draw first pixel
-    SSD1306_DrawPixel (x1, y1);
+    if (SSD1306_Band (lcd, page)) {
+      *dst = SSD1306_Rop (*dst, bit, bit, mode);
+    }
     // check if x1 equal x2
     while (x1 != x2) {
       // update x1
       x1 += trace_x;
+      dst += trace_x;
       // check if determinant is positive
       if (D >= 0) {
         // update y1
         y1 += trace_y;
+        bit = (trace_y > 0) ? bit << 1 : bit >> 1;
+        // next page
+        if (!bit) {
+          SSD1306_MarkSpan (lcd, page, from, x1 - trace_x);
+          bit = (trace_y > 0) ? 0x01 : 0x80;
+          dst += trace_page;
+          page += trace_y;
+          from = x1;
+        }
         // update determinant
         D -= 2*delta_x;    
       }
       // update deteminant
       D += 2*delta_y;
-      // draw next pixel
-      SSD1306_DrawPixel (x1, y1);
+      // draw next pixel, column differs from previous one
+      if (SSD1306_Band (lcd, page)) {
+        *dst = SSD1306_Rop (*dst, bit, bit, mode);
+      }
     }
+    // mark columns of last page
+    SSD1306_MarkSpan (lcd, page, from, x1);
   // for m > 1 (dy > dx)    
   } else {
     // calculate determinant
     D = delta_y - (delta_x << 1);
-    // draw first pixel
-    SSD1306_DrawPixel (x1, y1);
+    // line leaves screen
+    if (outside) {
+      // visible steps along y
+      if (SSD1306_ClipLine (y1, x1, trace_y, trace_x, delta_y, delta_x, max_y, END_COLUMN_ADDR, &first, &last)) {
+        // out of screen
+        return SSD1306_ERROR;
+      }
+      // move to first visible step
+      k = ((int64_t) 2 * delta_x * first + delta_y) / (2 * delta_y);
+      y2 = y1 + trace_y * last;
+      y1 += trace_y * first;
+      x1 += trace_x * k;
+      // determinant of first visible step
+      D += (int64_t) 2 * delta_y * k - (int64_t) 2 * delta_x * first;
+    }
+    // first pixel of run
+    run = y1;
     // check if y2 equal y1
     while (y1 != y2) {
-      // update y1
-      y1 += trace_y;
-      // check if determinant is positive
-      if (D <= 0) {
+      // pixels of run stay in column
+      while ((D > 0) && (y1 != y2)) {
         // update y1
-        x1 += trace_x;
-        // update determinant
-        D += 2*delta_y;    
+        y1 += trace_y;
+        // update deteminant
+        D -= 2*delta_x;
       }
-      // update deteminant
-      D -= 2*delta_x;
-      // draw next pixel
-      SSD1306_DrawPixel (x1, y1);
+      // last pixel reached
+      if (y1 == y2) {
+        break;
+      }
+      // draw run
+      SSD1306_DrawRun (lcd, x1, run, y1, mode);
+      // update y1 and x1, next run
+      y1 += trace_y;
+      x1 += trace_x;
+      run = y1;
+      // update determinant
+      D += 2*delta_y - 2*delta_x;
     }
+    // draw last run
+    SSD1306_DrawRun (lcd, x1, run, y1, mode);
   }
+
   // success return
   return SSD1306_SUCCESS;
 }
 
-void SSD1306_InsertBitmap(int offsetx, int offsety, const char* bitmap)
+/**
+ * @desc    Draw line in drawing mode, clipped to screen
+ *  
+ * @param   SSD1306_Display *
+ * @param   int16_t x start position
+ * @param   int16_t x end position
+ * @param   int16_t y start position
+ * @param   int16_t y end position
+ *
+ * @return  uint8_t SSD1306_ERROR if nothing visible
+ */
+uint8_t SSD1306_DrawLine (SSD1306_Display *lcd, int16_t x1, int16_t x2, int16_t y1, int16_t y2)
+{
+#ifdef SSD1306_PAGE_BUFFER
+  // recorded into display list, drawn page by page by update
+  if (SSD1306_BAND_IDLE == lcd->band) {
+    return SSD1306_Record (lcd, SSD1306_OP_LINE, x1, x2, y1, y2, NULL, NULL);
+  }
+#endif
+  // one specialized line per mode
+  switch (lcd->mode) {
+    case SSD1306_MODE_CLEAR:
+      return SSD1306_Line (lcd, x1, x2, y1, y2, SSD1306_MODE_CLEAR);
+    case SSD1306_MODE_XOR:
+    case SSD1306_MODE_INVERT:
+      return SSD1306_Line (lcd, x1, x2, y1, y2, SSD1306_MODE_XOR);
+    default:
+      return SSD1306_Line (lcd, x1, x2, y1, y2, SSD1306_MODE_SET);
+  }
+}
+
+/**
+ * @desc    Convert rows of 1 bit BMP into page-major bitmap, rows out of BMP are left out
+ *
+ * @param   SSD1306_Bitmap * converted bitmap, height 0 if no row is in BMP
+ * @param   uint8_t * buffer for converted data
+ * @param   uint16_t size of buffer
+ * @param   const uint8_t * BMP file
+ * @param   int16_t first row from top
+ * @param   int16_t last row from top
+ *
+ * @return  uint8_t
+ */
+static uint8_t SSD1306_Convert (SSD1306_Bitmap *bitmap, uint8_t *buffer, uint16_t size, const uint8_t *bmp, int16_t first, int16_t last)
 {
-  // insert a bitmap
-  int x,y;
-  uint32_t rows,cols;
-  memcpy(&cols, bitmap+18, 4);
-  memcpy(&rows, bitmap+22, 4);
-  // bitmap rows are 32-bit aligned.
-  int ccols = ((cols+31)/32)*32;
-  bitmap += 62;
+  // header
+  uint32_t offset;
+  int32_t cols, rows;
+  uint16_t bpp;
+  // bytes of one row, rows are 32-bit aligned
+  uint32_t stride;
+  // top-down order
+  uint8_t topdown = 0;
+  // converted rows
+  int16_t count;
+  // source row
+  const uint8_t *row;
+  int16_t x, y;
+
+  // header
+  memcpy (&offset, bmp + 10, 4);
+  memcpy (&cols, bmp + 18, 4);
+  memcpy (&rows, bmp + 22, 4);
+  memcpy (&bpp, bmp + 28, 2);
+  // empty or too high bitmap, negation of rows defined
+  if ((rows == 0) || (rows < -0xFF)) {
+    // error
+    return SSD1306_ERROR;
+  }
+  // negative height - top-down order
+  if (rows < 0) {
+    rows = -rows;
+    topdown = 1;
+  }
+  // rows in BMP
+  first = first < 0 ? 0 : first;
+  last = last >= rows ? rows - 1 : last;
+  count = last < first ? 0 : last - first + 1;
+  // only 1 bit bitmaps fitting into buffer
+  if ((bpp != 1) || (cols <= 0) || (cols > 0xFF) || (rows > 0xFF) || (SSD1306_BITMAP_SIZE (cols, count) > size)) {
+    // error
+    return SSD1306_ERROR;
+  }
+  stride = ((cols + 31) >> 5) << 2;
+
+  bitmap->width = cols;
+  bitmap->height = count;
+  bitmap->data = buffer;
+  memset (buffer, 0x00, SSD1306_BITMAP_SIZE (cols, count));
 
-  for (y=0; y<rows; y++)
-    for (x=0; x<cols; x++) {
-      uint bit = (bitmap[(y*ccols+x)/8] >> (7 - (x%8))) & 1;
-      if (bit) SSD1306_DrawPixel(offsetx+x,offsety+rows - y);
+  // loop through rows from top
+  for (y = 0; y < count; y++) {
+    row = bmp + offset + (topdown ? first + y : rows - 1 - first - y) * stride;
+    // loop through columns
+    for (x = 0; x < cols; x++) {
+      if (row[x >> 3] & (0x80 >> (x & 7))) {
+        buffer[(y >> 3) * cols + x] |= 1 << (y & 7);
+      }
     }
+  }
+
+  // success
+  return SSD1306_SUCCESS;
+}
+
+/**
+ * @desc    Load bitmap - convert 1 bit BMP into page-major bitmap
+ *          (8 vertical pixels per byte, LSB on top, columns of page follow each other)
+ *
+ * @param   SSD1306_Bitmap * converted bitmap
+ * @param   uint8_t * buffer for converted data
+ * @param   uint16_t size of buffer
+ * @param   const uint8_t * BMP file
+ *
+ * @return  uint8_t
+ */
+uint8_t SSD1306_LoadBitmap (SSD1306_Bitmap *bitmap, uint8_t *buffer, uint16_t size, const uint8_t *bmp)
+{
+  // all rows
+  return SSD1306_Convert (bitmap, buffer, size, bmp, 0, 0xFF);
+}
+
+/**
+ * @desc    Draw page-major bitmap in drawing mode, SSD1306_MODE_SET ORs set pixels into cache,
+ *          in page-buffer mode data has to stay valid until screen is cleared
+ *
+ * @param   SSD1306_Display *
+ * @param   int16_t x
+ * @param   int16_t y
+ * @param   const SSD1306_Bitmap *
+ *
+ * @return  uint8_t
+ */
+uint8_t SSD1306_DrawBitmap (SSD1306_Display *lcd, int16_t x, int16_t y, const SSD1306_Bitmap *bitmap)
+{
+#ifdef SSD1306_PAGE_BUFFER
+  // recorded into display list, drawn page by page by update
+  if (SSD1306_BAND_IDLE == lcd->band) {
+    return SSD1306_Record (lcd, SSD1306_OP_BITMAP, x, y, bitmap->width, bitmap->height, bitmap->data, NULL);
+  }
+#endif
+  // set pixels in drawing mode
+  SSD1306_BlitMode (lcd, x, y, bitmap->data, bitmap->width, bitmap->height, lcd->mode);
+
+  // success
+  return SSD1306_SUCCESS;
 }
 
+/**
+ * @desc    Insert BMP bitmap, converted on every call by rows of one page of display -
+ *          prefer SSD1306_LoadBitmap once and SSD1306_DrawBitmap (in page-buffer mode
+ *          only rows of rendered page are converted)
+ *
+ * @param   SSD1306_Display *
+ * @param   int x
+ * @param   int y, top row is drawn at y + 1
+ * @param   const uint8_t * BMP file
+ *
+ * @return  uint8_t
+ */
+uint8_t SSD1306_InsertBitmap (SSD1306_Display *lcd, int offsetx, int offsety, const uint8_t *bmp)
+{
+  // converted rows of one page, at most 255 columns
+  uint8_t buffer[0xFF];
+  SSD1306_Bitmap strip;
+  // top row on screen
+  int top = offsety + 1;
+  // status
+  uint8_t status = SSD1306_SUCCESS;
+  uint8_t page;
+
+#ifdef SSD1306_PAGE_BUFFER
+  // recorded into display list, drawn page by page by update
+  if (SSD1306_BAND_IDLE == lcd->band) {
+    return SSD1306_Record (lcd, SSD1306_OP_BMP, offsetx, offsety, 0, 0, bmp, NULL);
+  }
+#endif
+
+  // loop through pages of screen
+  for (page = START_PAGE_ADDR; (page < lcd->pages) && (SSD1306_SUCCESS == status); page++) {
+#ifdef SSD1306_PAGE_BUFFER
+    // page not rendered, all pages marked by recorded call
+    if ((SSD1306_BAND_NONE != lcd->band) && !SSD1306_Band (lcd, page)) {
+      continue;
+    }
+#endif
+    // rows of bitmap on page
+    status = SSD1306_Convert (&strip, buffer, sizeof(buffer), bmp, (page << 3) - top, (page << 3) + 7 - top);
+    // draw rows in drawing mode
+    if ((SSD1306_SUCCESS == status) && strip.height) {
+      SSD1306_BlitMode (lcd, offsetx, (page << 3) > top ? (page << 3) : top, strip.data, strip.width, strip.height, lcd->mode);
+    }
+  }
+
+  // status
+  return status;
+}
@@ -7,12 +7,12 @@
  *
  * @author      Marian Hrinko
  * @date        06.10.2020
- * @update      21.11.2022
+ * @update      17.10.2026
  * @file        ssd1306.h
  * @version     2.0.0
  * @tested      AVR Atmega328p
  *
- * @depend      string.h, font.h, twi.h
+ * @depend      string.h, fonts.h, twi.h, transport.h
  * -------------------------------------------------------------------------------------+
  * @descr       Version 1.0.0 -> applicable for 1 display
  *              Version 2.0.0 -> rebuild to 'cacheMemLcd' array
@@ -25,9 +25,12 @@
 #define __SSD1306_H__
 
   // @includes
+  #include <stdint.h>                     // fixed width types
   #include <string.h>                     // memset function
-  #include "font.h"
+  #include <time.h>                       // timespec
+  #include "fonts.h"
   #include "twi.h"
+  #include "transport.h"
 
   // Success / Error
   // ------------------------------------------------------------------------------------
@@ -55,10 +58,18 @@
   #define SSD1306_DIS_INVERSE       0xA7
   #define SSD1306_DEACT_SCROLL      0x2E
   #define SSD1306_ACTIVE_SCROLL     0x2F
+  #define SSD1306_SCROLL_RIGHT      0x26
+  #define SSD1306_SCROLL_LEFT       0x27
+  #define SSD1306_SCROLL_VERT_RIGHT 0x29
+  #define SSD1306_SCROLL_VERT_LEFT  0x2A
+  #define SSD1306_VERT_SCROLL_AREA  0xA3
   #define SSD1306_SET_START_LINE    0x40
   #define SSD1306_MEMORY_ADDR_MODE  0x20
   #define SSD1306_SET_COLUMN_ADDR   0x21
   #define SSD1306_SET_PAGE_ADDR     0x22
+  #define SSD1306_SET_LOW_COLUMN    0x00  // page addressing mode, 0x00 - 0x0F
+  #define SSD1306_SET_HIGH_COLUMN   0x10  // page addressing mode, 0x10 - 0x17
+  #define SSD1306_SET_PAGE_START    0xB0  // page addressing mode, 0xB0 - 0xB7
   #define SSD1306_SEG_REMAP         0xA0
   #define SSD1306_SEG_REMAP_OP      0xA1
   #define SSD1306_COM_SCAN_DIR      0xC0
@@ -84,138 +95,579 @@
   #define END_PAGE_ADDR             7     // 7 for 128x64, 3 for 128x32 version
   #define START_COLUMN_ADDR         0
   #define END_COLUMN_ADDR           127
-  #define RAM_X_END                 END_COLUMN_ADDR + 1
-  #define RAM_Y_END                 END_PAGE_ADDR + 1
+  #define RAM_X_END                 (END_COLUMN_ADDR + 1)
+  #define RAM_Y_END                 (END_PAGE_ADDR + 1)
 
-  #define CACHE_SIZE_MEM            (1 + END_PAGE_ADDR) * (1 + END_COLUMN_ADDR)
+  // page of cache starts by control byte slot (data stream), page is sent without copy
+  #define PAGE_SIZE_MEM             (1 + RAM_X_END)
+#ifdef SSD1306_PAGE_BUFFER
+  // page-buffer mode - one page of cache, drawing is recorded and rendered page by page
+  #define CACHE_PAGES               1
+  #define CACHE_INDEX(x, page)      (1 + (x))
+#else
+  #define CACHE_PAGES               RAM_Y_END
+  #define CACHE_INDEX(x, page)      (1 + (x) + (page) * PAGE_SIZE_MEM)
+#endif
+  #define CACHE_SIZE_MEM            (CACHE_PAGES * PAGE_SIZE_MEM)
 
   #define MAX_X                     END_COLUMN_ADDR
   #define MAX_Y                     (END_PAGE_ADDR + 1) * 8
 
-  // @var set area
-  // unsigned int _counter;
+  // Frame rate for 64MUX, default oscillator (0xD5, 0x80) and precharge (0xD9, 0xC2)
+  // ------------------------------------------------------------------------------------
+  #define SSD1306_FRAME_HZ          90
+
+  // Memory addressing mode
+  // ------------------------------------------------------------------------------------
+  #define SSD1306_ADDR_HORIZONTAL   0x00  // window of 0x21 / 0x22, 6 bytes
+  #define SSD1306_ADDR_VERTICAL     0x01
+  #define SSD1306_ADDR_PAGE         0x02  // 0xB0 | page and column nibbles, 1 - 3 bytes
+
+  // Controller state mirrored by driver, known registers are not sent again
+  // ------------------------------------------------------------------------------------
+  #define SSD1306_STATE_DISPLAY     0x01  // display on / off
+  #define SSD1306_STATE_INVERSE     0x02  // normal / inverse colors
+  #define SSD1306_STATE_CONTRAST    0x04  // contrast
+  #define SSD1306_STATE_START_LINE  0x08  // start line
+  #define SSD1306_STATE_ADDR_MODE   0x10  // memory addressing mode
+  #define SSD1306_STATE_WINDOW      0x20  // window of horizontal mode, RAM pointer on its start
+  #define SSD1306_STATE_ALL         0x3F
+
+  // Update batch limits, block of SSD1306_Begin / End has to fit in
+  // ------------------------------------------------------------------------------------
+#ifndef BATCH_MESSAGES
+#ifdef SSD1306_PAGE_BUFFER
+  #define BATCH_MESSAGES            16
+#else
+  #define BATCH_MESSAGES            64
+#endif
+#endif
+#ifndef BATCH_SIZE
+#ifdef SSD1306_PAGE_BUFFER
+  #define BATCH_SIZE                (4 * CACHE_SIZE_MEM)
+#else
+  #define BATCH_SIZE                (2 * CACHE_SIZE_MEM)
+#endif
+#endif
+
+  // Display list of page-buffer mode
+  // ------------------------------------------------------------------------------------
+  #ifndef SSD1306_LIST_OPS
+    #define SSD1306_LIST_OPS        32    // recorded drawing calls
+  #endif
+  #ifndef SSD1306_LIST_TEXT
+    #define SSD1306_LIST_TEXT       192   // characters of recorded strings, 8 lines of 21 fit
+  #endif
+
+  // Drawing mode
+  // ------------------------------------------------------------------------------------
+  #define SSD1306_MODE_SET          0x00  // pixels of object set
+  #define SSD1306_MODE_CLEAR        0x01  // pixels of object cleared
+  #define SSD1306_MODE_XOR          0x02  // pixels of object flipped, drawing again restores
+  #define SSD1306_MODE_INVERT       0x03  // whole area of object flipped (glyph cell, bitmap box)
+
+  // Bitmap
+  // ------------------------------------------------------------------------------------
+  #define SSD1306_BITMAP_SIZE(w, h) ((w) * (((h) + 7) >> 3))
+
+  // @struct Bitmap - page-major, 8 vertical pixels per byte (LSB on top)
+  typedef struct {
+    uint8_t width;
+    uint8_t height;
+    const uint8_t *data;                  // SSD1306_BITMAP_SIZE (width, height) bytes
+  } SSD1306_Bitmap;
+
+  // @struct Pointer - RAM pointer of display in page addressing mode
+  typedef struct {
+    uint8_t column;
+    uint8_t page;
+    uint8_t valid;                        // position known
+  } SSD1306_Pointer;
+
+  // @struct Window - columns and pages of update window
+  typedef struct {
+    uint8_t c0, c1;
+    uint8_t p0, p1;
+  } SSD1306_Window;
+
+  // @struct Op - drawing call recorded in display list, replayed into pages it touched
+  typedef struct {
+    uint8_t type;                         // drawing function
+    uint8_t mode;                         // SSD1306_MODE_* of drawing
+    uint8_t pages;                        // pages touched, bit per page
+    int16_t a, b, c, d;                   // arguments of drawing function
+    const void *data;                     // font, glyphs, bitmap data or BMP file, kept by pointer
+  } SSD1306_Op;
+
+  // @struct Display - state of one display, no state is shared between displays
+  typedef struct {
+    SSD1306_Transport *transport;         // transport, may be shared by several displays
+    uint8_t address;                      // address of display
+    uint8_t pages;                        // 8 for 128x64, 4 for 128x32 version
+    unsigned int counter;                 // set area
+    const SSD1306_Glyphs *glyphs;         // glyphs of SSD1306_DrawChar
+    uint8_t mode;                         // SSD1306_MODE_* of drawing
+    uint16_t wireBytes;                   // bytes put on the wire by last update
+    // frame
+    uint8_t cacheMemLcd[CACHE_SIZE_MEM];  // chache memory lcd, byte of column x at CACHE_INDEX (x, page)
+#ifndef SSD1306_PAGE_BUFFER
+    uint8_t shadowMemLcd[CACHE_SIZE_MEM]; // content of display RAM sent by last update
+#else
+    // display list
+    SSD1306_Op listOps[SSD1306_LIST_OPS]; // drawing calls since SSD1306_ClearScreen
+    char listText[SSD1306_LIST_TEXT];     // strings of recorded text
+    uint8_t listCount;                    // recorded calls
+    uint16_t listTextLength;              // used characters of strings
+    uint8_t band;                         // page rendered into cache, SSD1306_BAND_*
+    uint8_t touched;                      // pages marked by recorded call, bit per page
+    uint32_t pageSum[RAM_Y_END];          // hash of page content last sent
+#endif
+    uint8_t shadowValid;                  // pages of shadow (page hash) matching display RAM, bit per page
+    uint8_t dirtyStart[RAM_Y_END];        // first changed column of page
+    uint8_t dirtyEnd[RAM_Y_END];          // last changed column of page
+    uint8_t startLine;                    // RAM row shown on top of display
+    // controller state
+    uint8_t stateValid;                   // SSD1306_STATE_* matching display, cleared after error
+    uint8_t displayOn;                    // display on
+    uint8_t inverse;                      // inverse colors
+    uint8_t contrast;                     // contrast
+    uint8_t startLineSent;                // start line of display
+    uint8_t addrMode;                     // SSD1306_ADDR_* of display
+    SSD1306_Window addrWindow;            // window of horizontal addressing mode
+    SSD1306_Pointer pointer;              // RAM pointer after last update in page addressing mode
+    // scroll
+    uint8_t scrollActive;                 // continuous scroll running on display
+    uint8_t scrollCommand;                // SSD1306_SCROLL_*
+    uint8_t scrollStart;                  // first page of horizontal scroll
+    uint8_t scrollEnd;                    // last page of horizontal scroll
+    uint16_t scrollFrames;                // frames per step
+    uint8_t scrollRows;                   // rows per step of vertical scroll
+    struct timespec scrollSince;          // start of scroll
+    // update
+    uint8_t window[CACHE_SIZE_MEM];       // content of one window, transport without scatter
+    SSD1306_Message batchMessages[BATCH_MESSAGES];
+    uint8_t batchBuffer[BATCH_SIZE];
+    uint16_t batchCount;
+    uint16_t batchLength;
+    uint8_t batchDepth;                   // open SSD1306_Begin blocks
+    uint8_t batchSplit;                   // outermost block opened by library, sent in parts if full
+    uint8_t batchFailed;                  // call of open block dropped, block fails at end
+    uint8_t batchStart[RAM_Y_END];        // ranges of updates queued in open block,
+    uint8_t batchEnd[RAM_Y_END];          // marked dirty again if block is not sent
+    // asynchronous update
+    uint8_t owned;                        // display sent to by flush thread of SSD1306_Async only
+    pthread_t owner;                      // flush thread
+  } SSD1306_Display;
 
   /**
    * @desc    SSD1306 Init
    *
-   * @param   uint8_t
+   * @param   SSD1306_Display *
+   * @param   SSD1306_Transport *
+   * @param   uint8_t address
+   * @param   uint8_t height 64 / 32
    *
    * @return  uint8_t
    */
-  uint8_t SSD1306_Init (uint8_t);
+  uint8_t SSD1306_Init (SSD1306_Display *, SSD1306_Transport *, uint8_t, uint8_t);
 
   /**
    * @desc    SSD1306 Send Start and SLAW request
    *
-   * @param   uint8_t
+   * @param   SSD1306_Display *
    *
    * @return  uint8_t
    */
-  uint8_t SSD1306_Send_StartAndSLAW (uint8_t);
+  uint8_t SSD1306_Send_StartAndSLAW (SSD1306_Display *);
 
   /**
    * @desc    SSD1306 Send command
    *
+   * @param   SSD1306_Display *
    * @param   uint8_t
    *
    * @return  uint8_t
    */
-  uint8_t SSD1306_Send_Command (uint8_t);
+  uint8_t SSD1306_Send_Command (SSD1306_Display *, uint8_t);
+
+  /**
+   * @desc    SSD1306 Send command list in one transaction, queued inside SSD1306_Begin / End
+   *
+   * @param   SSD1306_Display *
+   * @param   const uint8_t *
+   * @param   uint16_t
+   *
+   * @return  uint8_t
+   */
+  uint8_t SSD1306_Send_Commands (SSD1306_Display *, const uint8_t *, uint16_t);
 
   /**
-   * @desc    SSD1306 Clear screen
+   * @desc    SSD1306 Begin transaction - commands, windows and data of following calls
+   *          are queued and sent by SSD1306_End in fewest messages by one call of
+   *          transport, calls return SSD1306_SUCCESS when queued. Block holds at most
+   *          BATCH_MESSAGES messages and BATCH_SIZE bytes of copied content (updates in
+   *          block are copied, two frames in full-buffer mode, four pages in page-buffer
+   *          mode), call not fitting fails with SSD1306_ERROR and so does SSD1306_End -
+   *          nothing of block is sent
    *
-   * @param   void
+   * @param   SSD1306_Display *
    *
    * @return  void
    */
-  void SSD1306_ClearScreen (void);
+  void SSD1306_Begin (SSD1306_Display *);
 
   /**
-   * @desc    SSD1306 Normal colors
+   * @desc    SSD1306 End transaction - send queued commands, windows and data
    *
-   * @param   uint8_t
+   * @param   SSD1306_Display *
    *
    * @return  uint8_t
    */
-  uint8_t SSD1306_NormalScreen (uint8_t);
+  uint8_t SSD1306_End (SSD1306_Display *);
 
   /**
-   * @desc    SSD1306 Inverse colors
+   * @desc    SSD1306 Clear screen, display list emptied in page-buffer mode
+   *
+   * @param   SSD1306_Display *
+   *
+   * @return  void
+   */
+  void SSD1306_ClearScreen (SSD1306_Display *);
+
+  /**
+   * @desc    SSD1306 Normal colors, not sent if display has them
+   *
+   * @param   SSD1306_Display *
+   *
+   * @return  uint8_t
+   */
+  uint8_t SSD1306_NormalScreen (SSD1306_Display *);
+
+  /**
+   * @desc    SSD1306 Inverse colors, not sent if display has them
+   *
+   * @param   SSD1306_Display *
    *
+   * @return  uint8_t
+   */
+  uint8_t SSD1306_InverseScreen (SSD1306_Display *);
+
+  /**
+   * @desc    SSD1306 Set contrast, not sent if display has it
+   *
+   * @param   SSD1306_Display *
    * @param   uint8_t
    *
    * @return  uint8_t
    */
-  uint8_t SSD1306_InverseScreen (uint8_t);
+  uint8_t SSD1306_SetContrast (SSD1306_Display *, uint8_t);
+
+  /**
+   * @desc    SSD1306 Display on, not sent if display is on
+   *
+   * @param   SSD1306_Display *
+   *
+   * @return  uint8_t
+   */
+  uint8_t SSD1306_DisplayOn (SSD1306_Display *);
+
+  /**
+   * @desc    SSD1306 Display off (sleep), RAM is kept, not sent if display is off
+   *
+   * @param   SSD1306_Display *
+   *
+   * @return  uint8_t
+   */
+  uint8_t SSD1306_DisplayOff (SSD1306_Display *);
+
+  /**
+   * @desc    SSD1306 Resync - mirrored state (on / off, colors, contrast, addressing
+   *          mode, start line) is sent again and next update rewrites whole RAM
+   *
+   * @param   SSD1306_Display *
+   *
+   * @return  uint8_t
+   */
+  uint8_t SSD1306_Resync (SSD1306_Display *);
 
   /**
-   * @desc    SSD1306 Update screen
+   * @desc    SSD1306 Update screen - sends only dirty column ranges of pages,
+   *          in page-buffer mode pages are rendered from display list one by one
    *
+   * @param   SSD1306_Display *
+   *
+   * @return  uint8_t
+   */
+  uint8_t SSD1306_UpdateScreen (SSD1306_Display *);
+
+  /**
+   * @desc    SSD1306 Update frame - sends changed bytes of dirty column ranges of frame
+   *
+   * @param   SSD1306_Display *
+   * @param   const uint8_t * frame of CACHE_SIZE_MEM bytes, layout of cacheMemLcd
+   * @param   const uint8_t * first dirty columns of pages
+   * @param   const uint8_t * last dirty columns of pages
+   *
+   * @return  uint8_t
+   */
+  uint8_t SSD1306_UpdateFrame (SSD1306_Display *, const uint8_t *, const uint8_t *, const uint8_t *);
+
+  /**
+   * @desc    SSD1306 Mark whole screen as dirty / clean
+   *
+   * @param   SSD1306_Display *
    * @param   uint8_t
    *
+   * @return  void
+   */
+  void SSD1306_MarkScreen (SSD1306_Display *, uint8_t);
+
+  /**
+   * @desc    SSD1306 Mark column range of page as dirty, any page of RAM
+   *
+   * @param   SSD1306_Display *
+   * @param   uint8_t page
+   * @param   uint8_t start column
+   * @param   uint8_t end column
+   *
+   * @return  void
+   */
+  void SSD1306_MarkRange (SSD1306_Display *, uint8_t, uint8_t, uint8_t);
+
+  /**
+   * @desc    SSD1306 Clear frame, control byte slots of pages set to data stream
+   *
+   * @param   uint8_t * frame of CACHE_SIZE_MEM bytes
+   *
+   * @return  void
+   */
+  void SSD1306_ClearCache (uint8_t *);
+
+  /**
+   * @desc    SSD1306 Set RAM row shown on top of display, sent by next update after content
+   *
+   * @param   SSD1306_Display *
+   * @param   uint8_t row of RAM 0 ... 63
+   *
+   * @return  void
+   */
+  void SSD1306_SetStartLine (SSD1306_Display *, uint8_t);
+
+  /**
+   * @desc    SSD1306 Start continuous scroll on display, no data is sent while scrolling
+   *
+   * @param   SSD1306_Display *
+   * @param   uint8_t SSD1306_SCROLL_RIGHT / SSD1306_SCROLL_LEFT
+   * @param   uint8_t first page
+   * @param   uint8_t last page
+   * @param   uint16_t frames per step (2, 3, 4, 5, 25, 64, 128, 256)
+   * @param   uint8_t rows per step of vertical scroll, 0 horizontal only
+   *
    * @return  uint8_t
    */
-  uint8_t SSD1306_UpdateScreen (uint8_t);
+  uint8_t SSD1306_StartScroll (SSD1306_Display *, uint8_t, uint8_t, uint8_t, uint16_t, uint8_t);
+
+  /**
+   * @desc    SSD1306 Stop scroll, cache follows display and scrolled pages are rewritten
+   *
+   * @param   SSD1306_Display *
+   *
+   * @return  uint8_t
+   */
+  uint8_t SSD1306_StopScroll (SSD1306_Display *);
+
+  /**
+   * @desc    SSD1306 Get number of bytes put on the wire by the last update
+   *
+   * @param   SSD1306_Display *
+   *
+   * @return  uint16_t
+   */
+  uint16_t SSD1306_GetWireBytes (SSD1306_Display *);
 
   /**
    * @desc    SSD1306 Update text position
    *
-   * @param   void
+   * @param   SSD1306_Display *
    *
    * @return  uint8_t
    */
-  uint8_t SSD1306_UpdatePosition (void);
+  uint8_t SSD1306_UpdatePosition (SSD1306_Display *);
+
+  /**
+   * @desc    SSD1306 Set drawing mode of pixels, lines, rectangles, text and bitmaps
+   *
+   * @param   SSD1306_Display *
+   * @param   uint8_t SSD1306_MODE_*
+   *
+   * @return  void
+   */
+  void SSD1306_SetDrawMode (SSD1306_Display *, uint8_t);
 
   /**
    * @desc    SSD1306 Set position
    *
+   * @param   SSD1306_Display *
    * @param   uint8_t
    * @param   uint8_t
    *
    * @return  void
    */
-  void SSD1306_SetPosition (uint8_t, uint8_t);
+  void SSD1306_SetPosition (SSD1306_Display *, uint8_t, uint8_t);
 
   /**
    * @desc    SSD1306 Draw character
    *
+   * @param   SSD1306_Display *
    * @param   char
    *
    * @return  uint8_t
    */
-  uint8_t SSD1306_DrawChar (char);
+  uint8_t SSD1306_DrawChar (SSD1306_Display *, char);
 
   /**
    * @desc    SSD1306 Draw string
    *
+   * @param   SSD1306_Display *
    * @param   char *
    *
-   * @return  void
+   * @return  uint8_t
    */
-  void SSD1306_DrawString (char *);
+  uint8_t SSD1306_DrawString (SSD1306_Display *, char *);
+
+  /**
+   * @desc    SSD1306 Draw text in font and scale at pixel position
+   *
+   * @param   SSD1306_Display *
+   * @param   int16_t
+   * @param   int16_t
+   * @param   const SSD1306_Font *
+   * @param   uint8_t scale 1 ... 4
+   * @param   const char *
+   *
+   * @return  uint8_t
+   */
+  uint8_t SSD1306_DrawText (SSD1306_Display *, int16_t, int16_t, const SSD1306_Font *, uint8_t, const char *);
+
+  /**
+   * @desc    SSD1306 Width of text in font and scale
+   *
+   * @param   const SSD1306_Font *
+   * @param   uint8_t
+   * @param   const char *
+   *
+   * @return  int16_t
+   */
+  int16_t SSD1306_TextWidth (const SSD1306_Font *, uint8_t, const char *);
 
   /**
    * @desc    Draw pixel
    *
+   * @param   SSD1306_Display *
    * @param   uint8_t
    * @param   uint8_t
    *
    * @return  uint8_t
    */
-  uint8_t SSD1306_DrawPixel (uint8_t, uint8_t);
+  uint8_t SSD1306_DrawPixel (SSD1306_Display *, uint8_t, uint8_t);
 
   /**
-   * @desc    Draw line
+   * @desc    Fill rectangle
+   *
+   * @param   SSD1306_Display *
+   * @param   int16_t
+   * @param   int16_t
+   * @param   int16_t
+   * @param   int16_t
+   *
+   * @return  uint8_t
+   */
+  uint8_t SSD1306_FillRect (SSD1306_Display *, int16_t, int16_t, int16_t, int16_t);
+
+  /**
+   * @desc    Draw rectangle outline
+   *
+   * @param   SSD1306_Display *
+   * @param   int16_t
+   * @param   int16_t
+   * @param   int16_t
+   * @param   int16_t
+   *
+   * @return  uint8_t
+   */
+  uint8_t SSD1306_DrawRect (SSD1306_Display *, int16_t, int16_t, int16_t, int16_t);
+
+  /**
+   * @desc    Draw horizontal line
+   *
+   * @param   SSD1306_Display *
+   * @param   int16_t
+   * @param   int16_t
+   * @param   int16_t
+   *
+   * @return  uint8_t
+   */
+  uint8_t SSD1306_DrawHLine (SSD1306_Display *, int16_t, int16_t, int16_t);
+
+  /**
+   * @desc    Draw vertical line
+   *
+   * @param   SSD1306_Display *
+   * @param   int16_t
+   * @param   int16_t
+   * @param   int16_t
+   *
+   * @return  uint8_t
+   */
+  uint8_t SSD1306_DrawVLine (SSD1306_Display *, int16_t, int16_t, int16_t);
+
+  /**
+   * @desc    Draw line, clipped to screen
    *  
-   * @param   uint8_t
-   * @param   uint8_t
-   * @param   uint8_t
-   * @param   uint8_t
+   * @param   SSD1306_Display *
+   * @param   int16_t x start
+   * @param   int16_t x end
+   * @param   int16_t y start
+   * @param   int16_t y end
+   *
+   * @return  uint8_t
+   */
+  uint8_t SSD1306_DrawLine (SSD1306_Display *, int16_t, int16_t, int16_t, int16_t);
+
+  /**
+   * @desc    Load bitmap - convert 1 bit BMP into page-major bitmap
+   *
+   * @param   SSD1306_Bitmap *
+   * @param   uint8_t * buffer
+   * @param   uint16_t size of buffer
+   * @param   const uint8_t * BMP file
+   *
+   * @return  uint8_t
+   */
+  uint8_t SSD1306_LoadBitmap (SSD1306_Bitmap *, uint8_t *, uint16_t, const uint8_t *);
+
+  /**
+   * @desc    Draw page-major bitmap, data kept by pointer in page-buffer mode
+   *
+   * @param   SSD1306_Display *
+   * @param   int16_t
+   * @param   int16_t
+   * @param   const SSD1306_Bitmap *
+   *
+   * @return  uint8_t
+   */
+  uint8_t SSD1306_DrawBitmap (SSD1306_Display *, int16_t, int16_t, const SSD1306_Bitmap *);
+
+  /**
+   * @desc    Insert bitmap, BMP converted on every call by rows of one page
+   *
+   * @param   SSD1306_Display *
+   * @param   int
+   * @param   int
+   * @param   const uint8_t *
    *
    * @return  uint8_t
    */
-  uint8_t SSD1306_DrawLine (uint8_t, uint8_t, uint8_t, uint8_t);
-  void SSD1306_InsertBitmap (int offsetx, int offsety, const char* bitmap);
+  uint8_t SSD1306_InsertBitmap (SSD1306_Display *, int, int, const uint8_t *);
 
 #endif
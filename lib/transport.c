@@ -0,0 +1,129 @@
+/**
+ * -------------------------------------------------------------------------------------+
+ * @desc        SSD1306 Transport interface
+ * -------------------------------------------------------------------------------------+
+ *              Copyright (C) 2020 Marian Hrinko.
+ *              Written by Marian Hrinko (mato.hrinko@gmail.com)
+ *
+ * @author      Marian Hrinko
+ * @date        17.10.2026
+ * @file        transport.c
+ * @version     1.0.0
+ * @tested      Linux i2c-dev, i2cdriver
+ *
+ * @depend      transport.h, i2cdev.h, i2cmini.h, emulator.h
+ * -------------------------------------------------------------------------------------+
+ * @usage       Runtime selection of backend
+ */
+
+// @includes
+#include "transport.h"
+#include "i2cdev.h"
+#include "i2cmini.h"
+#include "emulator.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/**
+ * @desc    Setup common part of transport, called by backend
+ *
+ * @param   SSD1306_Transport *
+ * @param   const SSD1306_TransportOps *
+ * @param   const char * backend name
+ * @param   const char * device path
+ * @param   uint16_t max bytes of one message
+ * @param   uint8_t TRANSPORT_CAP_*
+ *
+ * @return  void
+ */
+void SSD1306_TransportSetup (SSD1306_Transport *transport, const SSD1306_TransportOps *ops, const char *name, const char *device, uint16_t max_transfer, uint8_t caps)
+{
+  transport->ops = ops;
+  transport->name = name;
+  transport->device = device;
+  transport->max_transfer = max_transfer;
+  transport->caps = caps;
+  transport->users = 0;
+  pthread_mutex_init (&transport->lock, NULL);
+}
+
+/**
+ * @desc    Open transport, device is opened by first display only
+ *
+ * @param   SSD1306_Transport *
+ *
+ * @return  uint8_t
+ */
+uint8_t SSD1306_TransportOpen (SSD1306_Transport *transport)
+{
+  // status
+  uint8_t status = SSD1306_SUCCESS;
+
+  pthread_mutex_lock (&transport->lock);
+  // first display
+  if (!transport->users) {
+    status = transport->ops->open (transport);
+  }
+  // one more display
+  if (SSD1306_SUCCESS == status) {
+    transport->users++;
+  }
+  pthread_mutex_unlock (&transport->lock);
+
+  // status
+  return status;
+}
+
+/**
+ * @desc    Create transport by backend name
+ *
+ * @param   const char * backend name
+ * @param   const char * device path, NULL for default (bus clock [Hz] for emulator)
+ *
+ * @return  SSD1306_Transport *
+ */
+SSD1306_Transport * SSD1306_TransportCreate (const char *name, const char *device)
+{
+#if USE_I2C_DEVICE
+  if (!strcmp(name, "i2c-dev")) {
+    SSD1306_I2cDev *dev = malloc(sizeof(SSD1306_I2cDev));
+    return dev ? I2CDEV_Setup (dev, device) : NULL;
+  }
+#endif
+
+#if USE_I2CMINI
+  if (!strcmp(name, "i2cdriver")) {
+    SSD1306_I2cMini *mini = malloc(sizeof(SSD1306_I2cMini));
+    return mini ? I2CMINI_Setup (mini, device) : NULL;
+  }
+#endif
+
+  if (!strcmp(name, "emu")) {
+    SSD1306_Emulator *emu = malloc(sizeof(SSD1306_Emulator));
+    return emu ? EMU_Setup (emu, device ? atoi(device) : 0) : NULL;
+  }
+
+  // unknown backend
+  fprintf(stderr, "unknown transport %s\n", name);
+  return NULL;
+}
+
+/**
+ * @desc    Destroy transport created by SSD1306_TransportCreate
+ *
+ * @param   SSD1306_Transport *
+ *
+ * @return  void
+ */
+void SSD1306_TransportDestroy (SSD1306_Transport *transport)
+{
+  // opened by display
+  if (transport->users) {
+    transport->ops->close (transport);
+  }
+  pthread_mutex_destroy (&transport->lock);
+  // common part is first member of backend
+  free(transport);
+}
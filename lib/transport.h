@@ -0,0 +1,132 @@
+/**
+ * -------------------------------------------------------------------------------------+
+ * @desc        SSD1306 Transport interface
+ * -------------------------------------------------------------------------------------+
+ *              Copyright (C) 2020 Marian Hrinko.
+ *              Written by Marian Hrinko (mato.hrinko@gmail.com)
+ *
+ * @author      Marian Hrinko
+ * @date        17.10.2026
+ * @file        transport.h
+ * @version     1.0.0
+ * @tested      Linux i2c-dev, i2cdriver
+ *
+ * @depend      stdint.h, pthread.h
+ * -------------------------------------------------------------------------------------+
+ * @descr       Every backend (Linux i2c-dev, i2cdriver, ...) implements operations of
+ *              SSD1306_TransportOps and embeds SSD1306_Transport as its first member.
+ *              Backend is picked at runtime by SSD1306_TransportCreate. One transport
+ *              may be shared by several displays, every operation is serialized
+ *              by the transport lock.
+ * -------------------------------------------------------------------------------------+
+ * @usage       Transport of commands and data to display
+ */
+
+#ifndef __TRANSPORT_H__
+#define __TRANSPORT_H__
+
+  // @includes
+  #include <pthread.h>
+  #include <stdint.h>
+
+  // Backends compiled in
+  // ------------------------------------------------------------------------------------
+  #ifndef USE_I2C_DEVICE
+    #define USE_I2C_DEVICE          1     // Linux /dev/i2c-N
+  #endif
+  #ifndef USE_I2CMINI
+    #define USE_I2CMINI             1     // i2cdriver / i2cmini over /dev/ttyUSBN
+  #endif
+
+  // Success / Error
+  // ------------------------------------------------------------------------------------
+  #ifndef SSD1306_SUCCESS
+    #define SSD1306_SUCCESS         0
+  #endif
+  #ifndef SSD1306_ERROR
+    #define SSD1306_ERROR           1
+  #endif
+
+  // Capabilities
+  // ------------------------------------------------------------------------------------
+  #define TRANSPORT_CAP_SCATTER     0x01  // several messages handed over in one call
+
+  // @struct Message - raw bytes of one write transaction including control byte
+  typedef struct {
+    const uint8_t *buffer;
+    uint16_t length;
+  } SSD1306_Message;
+
+  // @struct Transport
+  typedef struct SSD1306_Transport SSD1306_Transport;
+
+  // @struct Transport operations, every operation returns SSD1306_SUCCESS / SSD1306_ERROR
+  typedef struct {
+    // open device
+    uint8_t (*open) (SSD1306_Transport *);
+    // commands behind one command stream control byte
+    uint8_t (*write_commands) (SSD1306_Transport *, uint8_t, const uint8_t *, uint16_t);
+    // data behind one data stream control byte
+    uint8_t (*write_data) (SSD1306_Transport *, uint8_t, const uint8_t *, uint16_t);
+    // commands followed by data
+    uint8_t (*write_command_and_data) (SSD1306_Transport *, uint8_t, const uint8_t *, uint16_t, const uint8_t *, uint16_t);
+    // prepared messages, required by TRANSPORT_CAP_SCATTER
+    uint8_t (*write_messages) (SSD1306_Transport *, uint8_t, const SSD1306_Message *, uint16_t);
+    // close device
+    void (*close) (SSD1306_Transport *);
+  } SSD1306_TransportOps;
+
+  // @struct Transport - common part of every backend
+  struct SSD1306_Transport {
+    const SSD1306_TransportOps *ops;
+    const char *name;                     // backend name
+    const char *device;                   // device path
+    uint16_t max_transfer;                // max bytes of one message
+    uint8_t caps;                         // TRANSPORT_CAP_*
+    pthread_mutex_t lock;                 // serializes operations of displays sharing transport
+    uint8_t users;                        // number of displays that opened transport
+  };
+
+  /**
+   * @desc    Setup common part of transport, called by backend
+   *
+   * @param   SSD1306_Transport *
+   * @param   const SSD1306_TransportOps *
+   * @param   const char * backend name
+   * @param   const char * device path
+   * @param   uint16_t max bytes of one message
+   * @param   uint8_t TRANSPORT_CAP_*
+   *
+   * @return  void
+   */
+  void SSD1306_TransportSetup (SSD1306_Transport *, const SSD1306_TransportOps *, const char *, const char *, uint16_t, uint8_t);
+
+  /**
+   * @desc    Open transport, device is opened by first display only
+   *
+   * @param   SSD1306_Transport *
+   *
+   * @return  uint8_t
+   */
+  uint8_t SSD1306_TransportOpen (SSD1306_Transport *);
+
+  /**
+   * @desc    Create transport by backend name
+   *
+   * @param   const char * backend name "i2c-dev" / "i2cdriver" / "emu"
+   * @param   const char * device path, NULL for default (bus clock [Hz] for "emu")
+   *
+   * @return  SSD1306_Transport *
+   */
+  SSD1306_Transport * SSD1306_TransportCreate (const char *, const char *);
+
+  /**
+   * @desc    Destroy transport created by SSD1306_TransportCreate
+   *
+   * @param   SSD1306_Transport *
+   *
+   * @return  void
+   */
+  void SSD1306_TransportDestroy (SSD1306_Transport *);
+
+#endif
@@ -25,7 +25,9 @@ typedef unsigned char uint8_t;
 
 // include libraries
 #include "lib/ssd1306.h"
-#include <unistd.h>
+#include "lib/scheduler.h"
+#include <stdio.h>
+#include <stdlib.h>
 #include "electrical.h"
 #include "exclamation.h"
 #include "network.h"
@@ -35,33 +37,65 @@ typedef unsigned char uint8_t;
 /**
  * @desc    Main function
  *
- * @param   void
+ * @param   int argc
+ * @param   char ** argv - [transport ("i2c-dev" / "i2cdriver")] [device] [height 64 / 32]
  *
  * @return  int
  */
-int main(void)
+int main(int argc, char **argv)
 {
   uint8_t addr = SSD1306_ADDR;
+  // display
+  static SSD1306_Display lcd;
+  // frame pacing
+  SSD1306_Scheduler scheduler;
+  // icons converted to page-major bitmaps
+  static uint8_t buffers[3][SSD1306_BITMAP_SIZE (48, 48)];
+  SSD1306_Bitmap exclamation, electrical, network;
+  // transport picked at runtime
+  SSD1306_Transport *transport = SSD1306_TransportCreate (argc > 1 ? argv[1] : "i2cdriver", argc > 2 ? argv[2] : NULL);
+
+  // transport not available
+  if (!transport) {
+    return 1;
+  }
 
   // init ssd1306
-  SSD1306_Init (addr);
+  if (SSD1306_SUCCESS != SSD1306_Init (&lcd, transport, addr, argc > 3 ? atoi(argv[3]) : 64)) {
+    return 1;
+  }
+
+  // convert icons once
+  if ((SSD1306_SUCCESS != SSD1306_LoadBitmap (&exclamation, buffers[0], sizeof(buffers[0]), bin2c_exclamation_bmp)) ||
+      (SSD1306_SUCCESS != SSD1306_LoadBitmap (&electrical, buffers[1], sizeof(buffers[1]), bin2c_electrical_bmp)) ||
+      (SSD1306_SUCCESS != SSD1306_LoadBitmap (&network, buffers[2], sizeof(buffers[2]), bin2c_network_bmp))) {
+    return 1;
+  }
+
+  // one frame per second
+  SSD1306_Scheduler_Start (&scheduler, 1000000);
 
   while (1) {
-    SSD1306_ClearScreen ();
-    //SSD1306_SetPosition (80,3);
-    //SSD1306_DrawString ("P S U");
-    SSD1306_InsertBitmap (0,0, bin2c_exclamation_bmp);
-    SSD1306_InsertBitmap (64,0, bin2c_electrical_bmp);
-    SSD1306_UpdateScreen (addr);
-    usleep(1000000);
+    SSD1306_ClearScreen (&lcd);
+    SSD1306_DrawBitmap (&lcd, 0, 1, &exclamation);
+    // alternate second icon
+    if (scheduler.frames & 1) {
+      //SSD1306_SetPosition (&lcd, 4,6);
+      //SSD1306_DrawString (&lcd, "Mit csinalunk ma?");
+      SSD1306_DrawBitmap (&lcd, 64, 1, &network);
+    } else {
+      //SSD1306_SetPosition (&lcd, 80,3);
+      //SSD1306_DrawString (&lcd, "P S U");
+      SSD1306_DrawBitmap (&lcd, 64, 1, &electrical);
+    }
+    SSD1306_Scheduler_Rendered (&scheduler);
+    SSD1306_UpdateScreen (&lcd);
+    SSD1306_Scheduler_Flushed (&scheduler);
 
-    SSD1306_ClearScreen ();
-    //SSD1306_SetPosition (4,6);
-    //SSD1306_DrawString ("Mit csinalunk ma?");
-    SSD1306_InsertBitmap (0,0, bin2c_exclamation_bmp);
-    SSD1306_InsertBitmap (64,0, bin2c_network_bmp);
-    SSD1306_UpdateScreen (addr);
-    usleep(1000000);
+    // wait for next frame
+    if (SSD1306_Scheduler_Wait (&scheduler)) {
+      fprintf (stderr, "frame overrun: render %.0f us, flush %.0f us\n", scheduler.render_us, scheduler.flush_us);
+    }
   }
 
   // return value